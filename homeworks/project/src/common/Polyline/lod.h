@@ -0,0 +1,188 @@
+#pragma once
+#include <_deps/imgui/imgui.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/**********************************************************************************
+/// @file       lod.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ύ ImDrawList ֮ǰĻռ߼
+/// @details    ҵĻãȺϲͬһ߳Ϊ tolerance ĸڵڵ㣬ٰβõĲ֣
+///             µÿһݲΪ tolerance  Douglas-Peucker 򻯣ͳʵύĶ
+///             ԭϵĵ㵽ύߵľ벻ӶԽ߼ݲ (1 + sqrt(2)) * tolerance
+**********************************************************************************/
+
+namespace Polyline {
+	struct LODStats {
+		int polylines{ 0 };
+		int generated{ 0 };		// ÷Ķ
+		int submitted{ 0 };		// ʵʽ AddPolyline Ķ
+
+		void Reset() { polylines = generated = submitted = 0; }
+	};
+
+	class LOD {
+	public:
+		bool enabled{ true };
+		float tolerance{ 0.25f };	// ϲӵı߳ Douglas-Peucker ݲأƫ (1 + sqrt(2)) * toleranceĬԼ 0.6 
+
+		/*
+		/// @brief      ÿ֡ǰ
+		/// @details    òüΣһ֡ͳƲ
+		/// @param[in]  : clipMin, clipMax : Ļ귶Χ
+		/// @return
+		/// @attention
+		*/
+		void BeginFrame(const ImVec2& clipMin, const ImVec2& clipMax) {
+			lo = clipMin;
+			hi = clipMax;
+			last = stats;
+			stats.Reset();
+		}
+
+		// һ֡ͳƣڻ֮ǰʾ
+		const LODStats& Stats() const { return last; }
+
+		// ڽʾͳ
+		void ShowControls(const char* label = "Polyline LOD") {
+			ImGui::Checkbox(label, &enabled);
+			ImGui::SameLine();
+			ImGui::Text("%d / %d vertices in %d polylines", last.submitted, last.generated, last.polylines);
+		}
+
+		/*
+		/// @brief       draw_list->AddPolyline
+		/// @details    points ΪĻꣻպ߱ÿʱպϵļύ
+		/// @param[in]  :
+		/// @return
+		/// @attention  رʱԭύ
+		*/
+		void AddPolyline(ImDrawList* drawList, const ImVec2* points, int n, ImU32 col, bool closed, float thickness) {
+			++stats.polylines;
+			stats.generated += n;
+			if (!enabled || n < 3) {
+				drawList->AddPolyline(points, n, col, closed, thickness);
+				stats.submitted += n;
+				return;
+			}
+
+			snap(points, n, closed);
+			const int m = static_cast<int>(snapped.size());
+			if (m < 2)
+				return;
+
+			// ˵ڻͬһ֮߶β߶γΪһ
+			const float margin = thickness + 1.0f;
+			codes.resize(m);
+			for (int i = 0; i < m; ++i)
+				codes[i] = outcode(snapped[i], margin);
+			int begin = -1;
+			for (int i = 0; i + 1 < m; ++i) {
+				bool visible = (codes[i] & codes[i + 1]) == 0;
+				if (visible && begin < 0)
+					begin = i;
+				if (!visible && begin >= 0) {
+					submit(drawList, begin, i, col, false, thickness);
+					begin = -1;
+				}
+			}
+			if (begin >= 0) {
+				// պȦɼʱ԰պύȥϵ׵
+				if (closed && begin == 0)
+					submit(drawList, 0, m - 2, col, true, thickness);
+				else
+					submit(drawList, begin, m - 1, col, false, thickness);
+			}
+		}
+
+	private:
+		// ϲͬһڵڵ㣬ĩ㣻պʱĩβ׵
+		// ϲĵ뱣ĵͬһڣƫӶԽ sqrt(2) * tolerance
+		void snap(const ImVec2* points, int n, bool closed) {
+			snapped.clear();
+			snapped.reserve(n + 1);
+			const float inv = 1.0f / std::max(tolerance, 1.0f / 64);
+			auto cell = [inv](const ImVec2& p) { return std::make_pair(floorf(p.x * inv), floorf(p.y * inv)); };
+			snapped.push_back(points[0]);
+			auto prev = cell(points[0]);
+			for (int i = 1; i < n; ++i) {
+				auto cur = cell(points[i]);
+				if (cur != prev) {
+					snapped.push_back(points[i]);
+					prev = cur;
+				}
+			}
+			if (snapped.size() > 1 && cell(points[n - 1]) == cell(snapped.back()))
+				snapped.back() = points[n - 1];
+			else if (snapped.size() == 1)
+				snapped.push_back(points[n - 1]);
+			if (closed)
+				snapped.push_back(snapped.front());
+		}
+
+		int outcode(const ImVec2& p, float margin) const {
+			return (p.x < lo.x - margin ? 1 : 0) | (p.x > hi.x + margin ? 2 : 0) | (p.y < lo.y - margin ? 4 : 0) | (p.y > hi.y + margin ? 8 : 0);
+		}
+
+		/*
+		/// @brief       snapped[first, end]  Douglas-Peucker 򻯺ύ
+		/// @details    ջݹ飬㵽߶εľ볬ݲʱԶ㲢
+		/// @param[in]  :
+		/// @return
+		/// @attention
+		*/
+		void submit(ImDrawList* drawList, int first, int end, ImU32 col, bool closed, float thickness) {
+			keep.assign(end - first + 1, 0);
+			keep.front() = keep.back() = 1;
+			const float tol2 = tolerance * tolerance;
+			stack.clear();
+			stack.emplace_back(first, end);
+			while (!stack.empty()) {
+				auto [a, b] = stack.back();
+				stack.pop_back();
+				if (b - a < 2)
+					continue;
+				const ImVec2 pa = snapped[a], pb = snapped[b];
+				const float ex = pb.x - pa.x, ey = pb.y - pa.y;
+				const float len2 = ex * ex + ey * ey;
+				int far = -1;
+				float best = tol2;
+				for (int i = a + 1; i < b; ++i) {
+					float dx = snapped[i].x - pa.x, dy = snapped[i].y - pa.y;
+					float u = len2 > 0.0f ? (dx * ex + dy * ey) / len2 : 0.0f;
+					u = u < 0.0f ? 0.0f : (u > 1.0f ? 1.0f : u);
+					float rx = dx - u * ex, ry = dy - u * ey;
+					float d2 = rx * rx + ry * ry;
+					if (d2 > best) {
+						best = d2;
+						far = i;
+					}
+				}
+				if (far < 0)
+					continue;
+				keep[far - first] = 1;
+				stack.emplace_back(a, far);
+				stack.emplace_back(far, b);
+			}
+			reduced.clear();
+			for (int i = first; i <= end; ++i) {
+				if (keep[i - first])
+					reduced.push_back(snapped[i]);
+			}
+			drawList->AddPolyline(reduced.data(), static_cast<int>(reduced.size()), col, closed, thickness);
+			stats.submitted += static_cast<int>(reduced.size());
+		}
+
+		ImVec2 lo{ 0.0f, 0.0f }, hi{ 0.0f, 0.0f };
+		LODStats stats, last;
+		std::vector<ImVec2> snapped;
+		std::vector<ImVec2> reduced;
+		std::vector<int> codes;
+		std::vector<char> keep;
+		std::vector<std::pair<int, int>> stack;
+	};
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <UGM/UGM.h>
+
+// ϳڱ༭⣬ÿһʵ壬
+
+// ݵϲʵ彨ú޸ģȡػ༭ʱʵ屻ɾʱ½ʵ壬
+//  version Ϊ 1CurveTessellation  version Ϊ 0 ʾδ
+struct CurveKnots {
+	std::vector<Ubpa::pointf2> points;	//  CanvasData::points ͬÿΪһ߶ΣΪݵ
+
+	bool enable_IP{ true };
+	bool enable_IG{ true };
+	bool enable_ALS{ true };
+	bool enable_ARR{ true };
+
+	int order_als = 1;
+	float lambda = 1.0f;
+	float sigma = 2.0f;
+	unsigned version{ 1 };
+};
+
+// Ϸݵ x ΧڵĲΧУversion  CurveKnots ͬʾЧ
+// ݵ x Χڻʱ
+struct CurveTessellation {
+	std::vector<std::vector<Ubpa::pointf2>> polylines;
+	Ubpa::pointf2 lo{ 0.f,0.f };
+	Ubpa::pointf2 hi{ 0.f,0.f };
+	unsigned version{ 0 };
+};
+
+#include "details/CurveData_AutoRefl.inl"
@@ -4,7 +4,7 @@
 
 namespace Fitting {
 
-	Eigen::VectorXf Approximation_LeastSquare(std::vector<Ubpa::pointf2> points, int order = 3) {
+	inline Eigen::VectorXf Approximation_LeastSquare(std::vector<Ubpa::pointf2> points, int order = 3) {
 		int n = points.size();
 
 		Eigen::MatrixXf normal_equation = Eigen::MatrixXf::Zero(n, order + 1);
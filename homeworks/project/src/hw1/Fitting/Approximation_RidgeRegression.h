@@ -4,7 +4,7 @@
 
 namespace Fitting {
 
-	Eigen::VectorXf Approximation_RidgeRegression(std::vector<Ubpa::pointf2> points, int order = 3, float lambda = 0.5) {
+	inline Eigen::VectorXf Approximation_RidgeRegression(std::vector<Ubpa::pointf2> points, int order = 3, float lambda = 0.5) {
 		int n = points.size();
 
 		Eigen::MatrixXf normal_equation = Eigen::MatrixXf::Zero(n, order + 1);
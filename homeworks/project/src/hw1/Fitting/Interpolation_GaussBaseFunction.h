@@ -4,11 +4,11 @@
 
 namespace Fitting {
 
-	float GaussBaseFunction(float x, float xi, float sigma) {
+	inline float GaussBaseFunction(float x, float xi, float sigma) {
 		return expf(-(x - xi) * (x - xi) / (2 * sigma * sigma));
 	}
 
-	Eigen::VectorXf Interpolation_GaussBaseFunction(std::vector<Ubpa::pointf2> points, float sigma = 1) {
+	inline Eigen::VectorXf Interpolation_GaussBaseFunction(std::vector<Ubpa::pointf2> points, float sigma = 1) {
 		int n = points.size();
 
 		Eigen::MatrixXf normal_equation = Eigen::MatrixXf::Ones(n + 1, n + 1);
@@ -3,7 +3,7 @@
 #include <Eigen/Dense>
 
 namespace Fitting {
-	Eigen::VectorXf Interpolation_PolynomialBaseFunction(
+	inline Eigen::VectorXf Interpolation_PolynomialBaseFunction(
 		std::vector<Ubpa::pointf2> points) {
 		int n = points.size();
 
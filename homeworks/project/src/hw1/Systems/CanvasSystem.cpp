@@ -1,6 +1,7 @@
 #include "CanvasSystem.h"
 
 #include "../Components/CanvasData.h"
+#include "../Components/CurveData.h"
 
 #include <_deps/imgui/imgui.h>
 
@@ -10,17 +11,67 @@
 #include"../Fitting/Interpolation_PolynomialBaseFunction.h"
 
 #include "spdlog/spdlog.h"
+#include "../../common/Polyline/lod.h"
+
+#include <algorithm>
+#include <cfloat>
 
 
 using namespace Ubpa;
 
 #define MAX_PLOT_NUM_POINTS 10000
 
+Polyline::LOD lod;	// ύǰĻռ
+std::vector<ImVec2> curvePolyline;	// õĻ
+
 void plot_IP(ImVec2*, CanvasData*, int&, const ImVec2, float, float);
 void plot_IG(ImVec2*, CanvasData*, int&, const ImVec2, float, float, float);
 void plot_AL(ImVec2*, CanvasData*, int&, const ImVec2, float, float, int);
 void plot_AR(ImVec2*, CanvasData*, int&, const ImVec2, float, float, int, float);
 
+// ڱ༭ߴΪһʵ壬صӵ״̬
+void stashCurve(Ubpa::UECS::World* w, CanvasData* data) {
+	if (data->points.size()) {
+		auto [e, knots, tess] = w->entityMngr.Create<CurveKnots, CurveTessellation>();
+		knots->points = std::move(data->points);
+		knots->enable_IP = data->enable_IP;
+		knots->enable_IG = data->enable_IG;
+		knots->enable_ALS = data->enable_ALS;
+		knots->enable_ARR = data->enable_ARR;
+		knots->order_als = data->order_als;
+		knots->lambda = data->lambda;
+		knots->sigma = data->sigma;
+	}
+	data->points.clear();
+	data->adding_line = false;
+}
+
+// ʵȡػ༭ǰߴΪʵ壬ȡصʵɾ
+void loadCurve(Ubpa::UECS::World* w, CanvasData* data, Ubpa::UECS::Entity e, CurveKnots&& knots) {
+	stashCurve(w, data);
+	w->entityMngr.Destroy(e);
+	data->points = std::move(knots.points);
+	data->enable_IP = knots.enable_IP;
+	data->enable_IG = knots.enable_IG;
+	data->enable_ALS = knots.enable_ALS;
+	data->enable_ARR = knots.enable_ARR;
+	data->order_als = knots.order_als;
+	data->lambda = knots.lambda;
+	data->sigma = knots.sigma;
+}
+
+// 㵽ߵľƽֻһʱΪõľƽ
+float distance2ToPolyline(const std::vector<Ubpa::pointf2>& polyline, const Ubpa::pointf2& p) {
+	float best = polyline.size() == 1 ? (p - polyline[0]).norm2() : FLT_MAX;
+	for (int k = 0; k + 1 < polyline.size(); ++k) {
+		Ubpa::vecf2 e = polyline[k + 1] - polyline[k];
+		float len2 = e.norm2();
+		float u = len2 > 0.0f ? std::min(std::max((p - polyline[k]).dot(e) / len2, 0.0f), 1.0f) : 0.0f;
+		best = std::min(best, (p - (polyline[k] + e * u)).norm2());
+	}
+	return best;
+}
+
 void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 	schedule.RegisterCommand([](Ubpa::UECS::World* w) {
 		auto data = w->entityMngr.GetSingleton<CanvasData>();
@@ -31,7 +82,8 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 		if (ImGui::Begin("Canvas")) {
 			ImGui::Checkbox("Enable grid", &data->opt_enable_grid);
 			ImGui::Checkbox("Enable context menu", &data->opt_enable_context_menu);
-			ImGui::Text("Mouse Left: drag to add lines, click to add points,\nMouse Right: drag to scroll, click for context menu.");
+			lod.ShowControls();
+			ImGui::Text("Mouse Left: drag to add lines, click to add points,\nMouse Right: drag to scroll, click for context menu.\nCtrl + Mouse Left: pick another curve to edit.");
 
 			ImGui::Checkbox("Lagrange", &data->enable_IP);
 			ImGui::SameLine(200);
@@ -74,6 +126,32 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			const bool is_active = ImGui::IsItemActive();   // Held
 			const ImVec2 origin(canvas_p0.x + data->scrolling[0], canvas_p0.y + data->scrolling[1]); // Lock scrolled origin
 			const pointf2 mouse_pos_in_canvas(io.MousePos.x - origin.x, io.MousePos.y - origin.y);
+			data->viewMin = valf2(canvas_p0.x - origin.x, canvas_p0.y - origin.y);
+			data->viewMax = valf2(canvas_p1.x - origin.x, canvas_p1.y - origin.y);
+
+			// Ctrl + ȡ߽б༭
+			if (is_hovered && io.KeyCtrl && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+				const float pick_radius = 8;
+				float best = pick_radius * pick_radius;
+				Ubpa::UECS::Entity picked;
+				CurveKnots pickedKnots;
+				w->RunEntityJob([&](Ubpa::UECS::Entity e, const CurveKnots* knots, const CurveTessellation* tess) {
+					if (tess->version != knots->version
+						|| mouse_pos_in_canvas[0] < tess->lo[0] - pick_radius || mouse_pos_in_canvas[0] > tess->hi[0] + pick_radius
+						|| mouse_pos_in_canvas[1] < tess->lo[1] - pick_radius || mouse_pos_in_canvas[1] > tess->hi[1] + pick_radius)
+						return;
+					for (const auto& polyline : tess->polylines) {
+						float d2 = distance2ToPolyline(polyline, mouse_pos_in_canvas);
+						if (d2 < best) {
+							best = d2;
+							picked = e;
+							pickedKnots = *knots;
+						}
+					}
+				}, false);
+				if (pickedKnots.points.size())
+					loadCurve(w, data, picked, std::move(pickedKnots));
+			}
 
 			// Add first and second point
 			if (!io.KeyCtrl && is_hovered && !data->adding_line && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
@@ -106,6 +184,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				data->adding_line = false;
 				if (ImGui::MenuItem("Remove one", NULL, false, data->points.size() > 0)) { data->points.resize(data->points.size() - 2); }
 				if (ImGui::MenuItem("Remove all", NULL, false, data->points.size() > 0)) { data->points.clear(); }
+				if (ImGui::MenuItem("New curve", NULL, false, data->points.size() > 0)) { stashCurve(w, data); }
 				ImGui::EndPopup();
 			}
 
@@ -129,13 +208,27 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			}
 			draw_list->PopClipRect();
 
+			lod.BeginFrame(canvas_p0, canvas_p1);
+
+			// ߣΧڻĲ
+			w->RunEntityJob([&](const CurveKnots* knots, const CurveTessellation* tess) {
+				if (tess->version != knots->version || tess->hi[0] < data->viewMin[0] || tess->lo[0] > data->viewMax[0] || tess->hi[1] < data->viewMin[1] || tess->lo[1] > data->viewMax[1])
+					return;
+				for (const auto& polyline : tess->polylines) {
+					curvePolyline.resize(polyline.size());
+					for (int n = 0; n < polyline.size(); ++n)
+						curvePolyline[n] = ImVec2(polyline[n][0] + origin.x, polyline[n][1] + origin.y);
+					lod.AddPolyline(draw_list, curvePolyline.data(), curvePolyline.size(), IM_COL32(0, 160, 0, 255), false, 1.0f);
+				}
+			}, false);
+
 			if (data->points.size() > 2) {
 				// IP
 				if (data->enable_IP) {
 					int p_index = 0;
 					ImVec2 IP[MAX_PLOT_NUM_POINTS];
 					plot_IP(IP, data, p_index, origin, canvas_p0.x, canvas_p1.x);
-					draw_list->AddPolyline(IP, p_index, IM_COL32(0, 255, 0, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, IP, p_index, IM_COL32(0, 255, 0, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20), IM_COL32(255, 255, 255, 255), "Lagrange");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13), IM_COL32(0, 255, 0, 255), 2.0f);
 				}
@@ -145,7 +238,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					int p_index = 0;
 					ImVec2 IG[MAX_PLOT_NUM_POINTS];
 					plot_IG(IG, data, p_index, origin, canvas_p0.x, canvas_p1.x, data->sigma);
-					draw_list->AddPolyline(IG, p_index, IM_COL32(0, 255, 255, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, IG, p_index, IM_COL32(0, 255, 255, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - data->enable_IP * 20), IM_COL32(255, 255, 255, 255), "Gauss Base");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - data->enable_IP * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - data->enable_IP * 20), IM_COL32(0, 255, 255, 255), 2.0f);
 				}
@@ -155,7 +248,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					int p_index = 0;
 					ImVec2 AL[MAX_PLOT_NUM_POINTS];
 					plot_AL(AL, data, p_index, origin, canvas_p0.x, canvas_p1.x, data->order_als);
-					draw_list->AddPolyline(AL, p_index, IM_COL32(217, 84, 19, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, AL, p_index, IM_COL32(217, 84, 19, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (data->enable_IP + data->enable_IG) * 20), IM_COL32(255, 255, 255, 255), "Least Square");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG) * 20), IM_COL32(217, 84, 19, 255), 2.0f);
 				}
@@ -165,7 +258,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					int p_index = 0;
 					ImVec2 AR[MAX_PLOT_NUM_POINTS];
 					plot_AR(AR, data, p_index, origin, canvas_p0.x, canvas_p1.x, data->order_als, data->lambda);
-					draw_list->AddPolyline(AR, p_index, IM_COL32(128, 91, 236, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, AR, p_index, IM_COL32(128, 91, 236, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (data->enable_IP + data->enable_IG + data->enable_ALS) * 20), IM_COL32(255, 255, 255, 255), "Ridge Regression");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG + data->enable_ALS) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG + data->enable_ALS) * 20), IM_COL32(128, 91, 236, 255), 2.0f);
 				}
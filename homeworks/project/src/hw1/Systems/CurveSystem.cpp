@@ -0,0 +1,101 @@
+#include "CurveSystem.h"
+
+#include "../Components/CanvasData.h"
+#include "../Components/CurveData.h"
+
+#include"../Fitting/Approximation_LeastSquare.h"
+#include"../Fitting/Approximation_RidgeRegression.h"
+#include"../Fitting/Interpolation_GaussBaseFunction.h"
+#include"../Fitting/Interpolation_PolynomialBaseFunction.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace Ubpa;
+
+constexpr auto MAX_CURVE_SAMPLES = 10000;	// ÿĲݵ x ΧԼÿλһ
+
+//  [x_left, x_right] ϾȲ y = f(x)
+template<typename F>
+std::vector<Ubpa::pointf2> samplePolyline(float x_left, float x_right, F&& f) {
+	int num = std::min(MAX_CURVE_SAMPLES, std::max(2, static_cast<int>(x_right - x_left) + 1));
+	std::vector<Ubpa::pointf2> polyline(num);
+	for (int i = 0; i < num; ++i) {
+		float x = x_left + (x_right - x_left) * i / (num - 1);
+		polyline[i] = Ubpa::pointf2(x, f(x));
+	}
+	return polyline;
+}
+
+// ʽ \sum c_j x^j
+float polynomial(const Eigen::VectorXf& c, float x) {
+	float fx = 0;
+	for (int j = 0; j < c.size(); ++j)
+		fx += c[j] * powf(x, j);
+	return fx;
+}
+
+void CurveSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
+	schedule.RegisterCommand([](Ubpa::UECS::World* w) {
+		auto data = w->entityMngr.GetSingleton<CanvasData>();
+		if (!data)
+			return;
+
+		const valf2 viewMin = data->viewMin;
+		const valf2 viewMax = data->viewMax;
+
+		// ֻδߣ x ĺݵ x ΧڻȲٴ
+		w->RunEntityJob([=](const CurveKnots* knots, CurveTessellation* tess) {
+			if (tess->version == knots->version)
+				return;
+			std::vector<Ubpa::pointf2> points;
+			float x_left = FLT_MAX, x_right = -FLT_MAX;
+			for (int n = 0; n < knots->points.size(); n += 2) {
+				points.push_back(knots->points[n]);
+				x_left = std::min(x_left, knots->points[n][0]);
+				x_right = std::max(x_right, knots->points[n][0]);
+			}
+			if (points.empty() || x_right < viewMin[0] || x_left > viewMax[0])
+				return;
+
+			tess->polylines.clear();
+			if (points.size() > 1) {
+				if (knots->enable_IP) {
+					Eigen::VectorXf c = Fitting::Interpolation_PolynomialBaseFunction(points);
+					tess->polylines.push_back(samplePolyline(x_left, x_right, [&](float x) { return polynomial(c, x); }));
+				}
+				if (knots->enable_IG) {
+					const float sigma = knots->sigma;
+					Eigen::VectorXf c = Fitting::Interpolation_GaussBaseFunction(points, sigma);
+					tess->polylines.push_back(samplePolyline(x_left, x_right, [&](float x) {
+						float fx = c[0];
+						for (int j = 1; j < c.size(); ++j)
+							fx += c[j] * expf(-(x - points[j - 1][0]) * (x - points[j - 1][0]) / (2 * sigma * sigma));
+						return fx;
+					}));
+				}
+				if (knots->enable_ALS) {
+					Eigen::VectorXf c = Fitting::Approximation_LeastSquare(points, knots->order_als);
+					tess->polylines.push_back(samplePolyline(x_left, x_right, [&](float x) { return polynomial(c, x); }));
+				}
+				if (knots->enable_ARR) {
+					Eigen::VectorXf c = Fitting::Approximation_RidgeRegression(points, knots->order_als, knots->lambda);
+					tess->polylines.push_back(samplePolyline(x_left, x_right, [&](float x) { return polynomial(c, x); }));
+				}
+			}
+			// ûϽʱݵߣԿɼѡȡ
+			if (tess->polylines.empty())
+				tess->polylines.push_back(points);
+
+			tess->lo = Ubpa::pointf2(FLT_MAX, FLT_MAX);
+			tess->hi = Ubpa::pointf2(-FLT_MAX, -FLT_MAX);
+			for (const auto& polyline : tess->polylines) {
+				for (const auto& p : polyline) {
+					tess->lo = Ubpa::pointf2(std::min(tess->lo[0], p[0]), std::min(tess->lo[1], p[1]));
+					tess->hi = Ubpa::pointf2(std::max(tess->hi[0], p[0]), std::max(tess->hi[1], p[1]));
+				}
+			}
+			tess->version = knots->version;
+		});
+	});
+}
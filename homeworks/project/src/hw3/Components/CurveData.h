@@ -0,0 +1,34 @@
+#pragma once
+
+#include <UGM/UGM.h>
+
+// ϳڱ༭⣬ÿһʵ壬
+
+// ݵϲʵ彨ú޸ģȡػ༭ʱʵ屻ɾʱ½ʵ壬
+//  version Ϊ 1CurveTessellation  version Ϊ 0 ʾδ
+struct CurveKnots {
+	std::vector<Ubpa::pointf2> points;	//  CanvasData::points ͬÿΪһ߶ΣΪݵ
+
+	bool enable_IP{ false };
+	bool enable_IG{ true };
+	bool enable_ALS{ true };
+	bool enable_ARR{ false };
+
+	int order_als = 1;
+	float lambda = 1.0f;
+	float sigma = 0.1f;
+	int order_arr = 1;
+
+	int parametrizationType = 0;
+	unsigned version{ 1 };
+};
+
+// Ϸ t  [0, 1] ϵĲΧУversion  CurveKnots ͬʾЧ
+struct CurveTessellation {
+	std::vector<std::vector<Ubpa::pointf2>> polylines;
+	Ubpa::pointf2 lo{ 0.f,0.f };
+	Ubpa::pointf2 hi{ 0.f,0.f };
+	unsigned version{ 0 };
+};
+
+#include "details/CurveData_AutoRefl.inl"
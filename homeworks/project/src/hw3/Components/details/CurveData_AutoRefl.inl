@@ -0,0 +1,70 @@
+// This file is generated by Ubpa::USRefl::AutoRefl
+
+#pragma once
+
+#include <USRefl/USRefl.h>
+
+template<>
+struct Ubpa::USRefl::TypeInfo<CurveKnots> :
+    TypeInfoBase<CurveKnots>
+{
+#ifdef UBPA_USREFL_NOT_USE_NAMEOF
+    static constexpr char name[11] = "CurveKnots";
+#endif
+    static constexpr AttrList attrs = {};
+    static constexpr FieldList fields = {
+        Field {TSTR("points"), &Type::points},
+        Field {TSTR("enable_IP"), &Type::enable_IP, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("enable_IG"), &Type::enable_IG, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { true }; }},
+        }},
+        Field {TSTR("enable_ALS"), &Type::enable_ALS, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { true }; }},
+        }},
+        Field {TSTR("enable_ARR"), &Type::enable_ARR, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("order_als"), &Type::order_als, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 1; }},
+        }},
+        Field {TSTR("lambda"), &Type::lambda, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->float{ return 1.0f; }},
+        }},
+        Field {TSTR("sigma"), &Type::sigma, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->float{ return 0.1f; }},
+        }},
+        Field {TSTR("order_arr"), &Type::order_arr, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 1; }},
+        }},
+        Field {TSTR("parametrizationType"), &Type::parametrizationType, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 0; }},
+        }},
+        Field {TSTR("version"), &Type::version, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->unsigned{ return { 1 }; }},
+        }},
+    };
+};
+
+template<>
+struct Ubpa::USRefl::TypeInfo<CurveTessellation> :
+    TypeInfoBase<CurveTessellation>
+{
+#ifdef UBPA_USREFL_NOT_USE_NAMEOF
+    static constexpr char name[18] = "CurveTessellation";
+#endif
+    static constexpr AttrList attrs = {};
+    static constexpr FieldList fields = {
+        Field {TSTR("polylines"), &Type::polylines},
+        Field {TSTR("lo"), &Type::lo, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->Ubpa::pointf2{ return { 0.f,0.f }; }},
+        }},
+        Field {TSTR("hi"), &Type::hi, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->Ubpa::pointf2{ return { 0.f,0.f }; }},
+        }},
+        Field {TSTR("version"), &Type::version, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->unsigned{ return { 0 }; }},
+        }},
+    };
+};
@@ -3,7 +3,7 @@
 #include <Eigen/Dense>
 
 namespace Fitting {
-	Eigen::VectorXf Interpolation_PolynomialBaseFunction(
+	inline Eigen::VectorXf Interpolation_PolynomialBaseFunction(
 		std::vector<Ubpa::pointf2> points) {
 		int n = points.size();
 
@@ -18,11 +18,11 @@ namespace Fitting {
 		return normal_equation.colPivHouseholderQr().solve(y);
 	}
 
-	float GaussBaseFunction(float x, float xi, float sigma) {
+	inline float GaussBaseFunction(float x, float xi, float sigma) {
 		return expf(-(x - xi) * (x - xi) / (2 * sigma * sigma));
 	}
 
-	Eigen::VectorXf Interpolation_GaussBaseFunction(std::vector<Ubpa::pointf2> points, float sigma = 1) {
+	inline Eigen::VectorXf Interpolation_GaussBaseFunction(std::vector<Ubpa::pointf2> points, float sigma = 1) {
 		int n = points.size();
 
 		Eigen::MatrixXf normal_equation = Eigen::MatrixXf::Ones(n + 1, n + 1);
@@ -40,7 +40,7 @@ namespace Fitting {
 		//return normal_equation.inverse() * y;
 	}
 
-	Eigen::VectorXf Approximation_LeastSquare(std::vector<Ubpa::pointf2> points, int order = 3) {
+	inline Eigen::VectorXf Approximation_LeastSquare(std::vector<Ubpa::pointf2> points, int order = 3) {
 		int n = points.size();
 
 		Eigen::MatrixXf normal_equation = Eigen::MatrixXf::Zero(n, order + 1);
@@ -57,7 +57,7 @@ namespace Fitting {
 		//return (normal_equation.transpose() * normal_equation).inverse() * (normal_equation.transpose() * y);
 	}
 
-	Eigen::VectorXf Approximation_RidgeRegression(std::vector<Ubpa::pointf2> points, int order = 3, float lambda = 0.5) {
+	inline Eigen::VectorXf Approximation_RidgeRegression(std::vector<Ubpa::pointf2> points, int order = 3, float lambda = 0.5) {
 		int n = points.size();
 
 		Eigen::MatrixXf normal_equation = Eigen::MatrixXf::Zero(n, order + 1);
@@ -20,7 +20,7 @@ namespace Parametrization {
 	/// @return     
 	/// @attention  
 	*/
-	Eigen::VectorXf chordParameterization(std::vector<Ubpa::pointf2> points) {
+	inline Eigen::VectorXf chordParameterization(std::vector<Ubpa::pointf2> points) {
 		int n = points.size();
 		Eigen::VectorXf y = Eigen::VectorXf::Zero(n);
 		for (int i = 1; i < n; ++i)
@@ -36,7 +36,7 @@ namespace Parametrization {
 	/// @return     
 	/// @attention  
 	*/
-	Eigen::VectorXf centripetalParameterization(std::vector<Ubpa::pointf2> points) {
+	inline Eigen::VectorXf centripetalParameterization(std::vector<Ubpa::pointf2> points) {
 		int n = points.size();
 		Eigen::VectorXf y = Eigen::VectorXf::Zero(n);
 		for (int i = 1; i < n; ++i)
@@ -52,7 +52,7 @@ namespace Parametrization {
 	/// @return     
 	/// @attention  
 	*/
-	Eigen::VectorXf uniformParameterization(int numOfPoints) {
+	inline Eigen::VectorXf uniformParameterization(int numOfPoints) {
 		Eigen::VectorXf y = Eigen::VectorXf::Zero(numOfPoints);
 		for (int i = 0; i < numOfPoints; ++i)
 			y[i] = i;
@@ -68,7 +68,7 @@ namespace Parametrization {
 	/// @return     
 	/// @attention  
 	*/
-	Eigen::VectorXf FoleyParameterization(std::vector<Ubpa::pointf2> points) {
+	inline Eigen::VectorXf FoleyParameterization(std::vector<Ubpa::pointf2> points) {
 		int n = points.size();
 		Eigen::VectorXf y = Eigen::VectorXf::Zero(n);
 		if (n == 2) { y[1] = 1; return y; }
@@ -91,4 +91,26 @@ namespace Parametrization {
 		y /= y[n - 1];
 		return y;
 	}
+
+	/*
+	/// @brief      Ͳ
+	/// @details    ʵ干
+	/// @param[in]  parametrizationType: 0 ҳ  1   2   3 Foley
+	/// @return     
+	/// @attention  
+	*/
+	inline Eigen::VectorXf parametrization(std::vector<Ubpa::pointf2> points, int parametrizationType) {
+		switch (parametrizationType) {
+		case 0:
+			return chordParameterization(points);
+		case 1:
+			return centripetalParameterization(points);
+		case 2:
+			return uniformParameterization(points.size());
+		case 3:
+			return FoleyParameterization(points);
+		default:
+			return chordParameterization(points);
+		}
+	}
 }
\ No newline at end of file
@@ -1,15 +1,19 @@
 #include "CanvasSystem.h"
 
 #include "../Components/CanvasData.h"
+#include "../Components/CurveData.h"
 
 #include <_deps/imgui/imgui.h>
-#include "../ImGuiFileBrowser.h"
+#include "../../common/ImGuiFileBrowser/ImGuiFileBrowser.h"
 
 #include"../Fitting/fitting.h"
 #include "../Parametrization/parametrization.h"
 
 #include "spdlog/spdlog.h"
+#include "../../common/Polyline/lod.h"
 
+#include <algorithm>
+#include <cfloat>
 #include <fstream>
 
 
@@ -21,8 +25,57 @@ void plot_IP(ImVec2*, CanvasData*, int&, const ImVec2, int);
 void plot_IG(ImVec2*, CanvasData*, int&, const ImVec2, float, int);
 void plot_AL(ImVec2*, CanvasData*, int&, const ImVec2, int, int);
 void plot_AR(ImVec2*, CanvasData*, int&, const ImVec2, int, float, int);
-Eigen::VectorXf parametrization(std::vector<Ubpa::pointf2>, int);
 imgui_addons::ImGuiFileBrowser file_dialog;
+Polyline::LOD lod;	// ύǰĻռ
+std::vector<ImVec2> curvePolyline;	// õĻ
+
+// ڱ༭ߴΪһʵ壬صӵ״̬
+void stashCurve(Ubpa::UECS::World* w, CanvasData* data) {
+	if (data->points.size()) {
+		auto [e, knots, tess] = w->entityMngr.Create<CurveKnots, CurveTessellation>();
+		knots->points = std::move(data->points);
+		knots->enable_IP = data->enable_IP;
+		knots->enable_IG = data->enable_IG;
+		knots->enable_ALS = data->enable_ALS;
+		knots->enable_ARR = data->enable_ARR;
+		knots->order_als = data->order_als;
+		knots->lambda = data->lambda;
+		knots->sigma = data->sigma;
+		knots->order_arr = data->order_arr;
+		knots->parametrizationType = data->parametrizationType;
+	}
+	data->points.clear();
+	data->adding_line = false;
+	data->enable_RBF = false;
+}
+
+// ʵȡػ༭ǰߴΪʵ壬ȡصʵɾ
+void loadCurve(Ubpa::UECS::World* w, CanvasData* data, Ubpa::UECS::Entity e, CurveKnots&& knots) {
+	stashCurve(w, data);
+	w->entityMngr.Destroy(e);
+	data->points = std::move(knots.points);
+	data->enable_IP = knots.enable_IP;
+	data->enable_IG = knots.enable_IG;
+	data->enable_ALS = knots.enable_ALS;
+	data->enable_ARR = knots.enable_ARR;
+	data->order_als = knots.order_als;
+	data->lambda = knots.lambda;
+	data->sigma = knots.sigma;
+	data->order_arr = knots.order_arr;
+	data->parametrizationType = knots.parametrizationType;
+}
+
+// 㵽ߵľƽֻһʱΪõľƽ
+float distance2ToPolyline(const std::vector<Ubpa::pointf2>& polyline, const Ubpa::pointf2& p) {
+	float best = polyline.size() == 1 ? (p - polyline[0]).norm2() : FLT_MAX;
+	for (int k = 0; k + 1 < polyline.size(); ++k) {
+		Ubpa::vecf2 e = polyline[k + 1] - polyline[k];
+		float len2 = e.norm2();
+		float u = len2 > 0.0f ? std::min(std::max((p - polyline[k]).dot(e) / len2, 0.0f), 1.0f) : 0.0f;
+		best = std::min(best, (p - (polyline[k] + e * u)).norm2());
+	}
+	return best;
+}
 
 void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 	spdlog::set_pattern("[%H:%M:%S] %v");
@@ -48,6 +101,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				ImGui::Text("USER GUIDE:");
 				ImGui::BulletText("Mouse Left: drag to add lines, click to add points.");
 				ImGui::BulletText("Mouse Right: drag to scroll, click for context menu.");
+				ImGui::BulletText("Ctrl + Mouse Left: pick another curve to edit.");
 				ImGui::BulletText("Ctrl+O: Import Data");
 				ImGui::BulletText("Ctrl+S: Export Data");
 				ImGui::BulletText("Ctrl+UP/DOWN: sigma += 0.001 / sigma -= 0.001");
@@ -64,6 +118,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 
 			ImGui::Checkbox("Enable grid", &data->opt_enable_grid); ImGui::SameLine(200);
 			ImGui::Checkbox("Enable context menu", &data->opt_enable_context_menu);
+			lod.ShowControls();
 			
 			ImGui::Separator();
 
@@ -141,9 +196,35 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			const bool is_active = ImGui::IsItemActive();   // Held
 			const ImVec2 origin(canvas_p0.x + data->scrolling[0], canvas_p0.y + data->scrolling[1]); // Lock scrolled origin
 			const pointf2 mouse_pos_in_canvas(io.MousePos.x - origin.x, io.MousePos.y - origin.y);
+			data->viewMin = valf2(canvas_p0.x - origin.x, canvas_p0.y - origin.y);
+			data->viewMax = valf2(canvas_p1.x - origin.x, canvas_p1.y - origin.y);
+
+			// Ctrl + ȡ߽б༭
+			if (is_hovered && io.KeyCtrl && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+				const float pick_radius = 7;
+				float best = pick_radius * pick_radius;
+				Ubpa::UECS::Entity picked;
+				CurveKnots pickedKnots;
+				w->RunEntityJob([&](Ubpa::UECS::Entity e, const CurveKnots* knots, const CurveTessellation* tess) {
+					if (tess->version != knots->version
+						|| mouse_pos_in_canvas[0] < tess->lo[0] - pick_radius || mouse_pos_in_canvas[0] > tess->hi[0] + pick_radius
+						|| mouse_pos_in_canvas[1] < tess->lo[1] - pick_radius || mouse_pos_in_canvas[1] > tess->hi[1] + pick_radius)
+						return;
+					for (const auto& polyline : tess->polylines) {
+						float d2 = distance2ToPolyline(polyline, mouse_pos_in_canvas);
+						if (d2 < best) {
+							best = d2;
+							picked = e;
+							pickedKnots = *knots;
+						}
+					}
+				}, false);
+				if (pickedKnots.points.size())
+					loadCurve(w, data, picked, std::move(pickedKnots));
+			}
 
 			// Add first and second point
-			if (is_hovered && !data->adding_line && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+			if (is_hovered && !data->adding_line && !io.KeyCtrl && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
 				data->points.push_back(mouse_pos_in_canvas);
 				data->points.push_back(mouse_pos_in_canvas);
 				data->adding_line = true;
@@ -234,6 +315,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				data->adding_line = false;
 				if (ImGui::MenuItem("Remove one", NULL, false, data->points.size() > 0)) { data->points.resize(data->points.size() - 2); }
 				if (ImGui::MenuItem("Remove all", NULL, false, data->points.size() > 0)) { data->points.clear(); }
+				if (ImGui::MenuItem("New curve", NULL, false, data->points.size() > 0)) { stashCurve(w, data); }
 				ImGui::EndPopup();
 			}
 
@@ -257,13 +339,27 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			}
 			draw_list->PopClipRect();
 			if (data->points.size() <= 2) data->enable_RBF = false;
+			lod.BeginFrame(canvas_p0, canvas_p1);
+
+			// ߣΧڻĲ
+			w->RunEntityJob([&](const CurveKnots* knots, const CurveTessellation* tess) {
+				if (tess->version != knots->version || tess->hi[0] < data->viewMin[0] || tess->lo[0] > data->viewMax[0] || tess->hi[1] < data->viewMin[1] || tess->lo[1] > data->viewMax[1])
+					return;
+				for (const auto& polyline : tess->polylines) {
+					curvePolyline.resize(polyline.size());
+					for (int n = 0; n < polyline.size(); ++n)
+						curvePolyline[n] = ImVec2(polyline[n][0] + origin.x, polyline[n][1] + origin.y);
+					lod.AddPolyline(draw_list, curvePolyline.data(), curvePolyline.size(), IM_COL32(0, 160, 0, 255), false, 1.0f);
+				}
+			}, false);
+
 			if (data->points.size() > 2) {
 				// IP
 				if (data->enable_IP) {
 					int p_index = 0;
 					ImVec2 IP[MAX_PLOT_NUM_POINTS];
 					plot_IP(IP, data, p_index, origin, data->parametrizationType);
-					draw_list->AddPolyline(IP, p_index, IM_COL32(0, 255, 0, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, IP, p_index, IM_COL32(0, 255, 0, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20), IM_COL32(255, 255, 255, 255), "Lagrange");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13), IM_COL32(0, 255, 0, 255), 2.0f);
 				}
@@ -273,7 +369,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					int p_index = 0;
 					ImVec2 IG[MAX_PLOT_NUM_POINTS];
 					plot_IG(IG, data, p_index, origin, data->sigma, data->parametrizationType);
-					draw_list->AddPolyline(IG, p_index, IM_COL32(0, 255, 255, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, IG, p_index, IM_COL32(0, 255, 255, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - data->enable_IP * 20), IM_COL32(255, 255, 255, 255), "Gauss Base");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - data->enable_IP * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - data->enable_IP * 20), IM_COL32(0, 255, 255, 255), 2.0f);
 				}
@@ -283,7 +379,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					int p_index = 0;
 					ImVec2 AL[MAX_PLOT_NUM_POINTS];
 					plot_AL(AL, data, p_index, origin, data->order_als, data->parametrizationType);
-					draw_list->AddPolyline(AL, p_index, IM_COL32(217, 84, 19, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, AL, p_index, IM_COL32(217, 84, 19, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (data->enable_IP + data->enable_IG) * 20), IM_COL32(255, 255, 255, 255), "Least Square");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG) * 20), IM_COL32(217, 84, 19, 255), 2.0f);
 				}
@@ -293,7 +389,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					int p_index = 0;
 					ImVec2 AR[MAX_PLOT_NUM_POINTS];
 					plot_AR(AR, data, p_index, origin, data->order_arr, data->lambda, data->parametrizationType);
-					draw_list->AddPolyline(AR, p_index, IM_COL32(128, 91, 236, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, AR, p_index, IM_COL32(128, 91, 236, 255), false, 2.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (data->enable_IP + data->enable_IG + data->enable_ALS) * 20), IM_COL32(255, 255, 255, 255), "Ridge Regression");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG + data->enable_ALS) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (data->enable_IP + data->enable_IG + data->enable_ALS) * 20), IM_COL32(128, 91, 236, 255), 2.0f);
 				}
@@ -304,7 +400,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					std::vector<Ubpa::pointf2> points;
 					for (int n = 0; n < data->points.size(); n += 2)
 						points.push_back(data->points[n] + origin);
-					Eigen::VectorXf t = parametrization(points, data->parametrizationType);
+					Eigen::VectorXf t = Parametrization::parametrization(points, data->parametrizationType);
 					std::ofstream outrbf_x("tx.txt");
 					std::ofstream outrbf_y("ty.txt");
 					for (int n = 0; n < points.size(); ++n) {
@@ -333,7 +429,7 @@ void plot_IP(ImVec2* p, CanvasData* data, int& p_index, const ImVec2 origin, int
 		points.push_back(data->points[n] + origin);
 
 	//parametrization
-	Eigen::VectorXf t = parametrization(points, parametrizationType);
+	Eigen::VectorXf t = Parametrization::parametrization(points, parametrizationType);
 
 	std::vector<Ubpa::pointf2> tx, ty;
 	for (int i = 0; i < points.size(); ++i) {
@@ -361,7 +457,7 @@ void plot_IG(ImVec2* p, CanvasData* data, int& p_index, const ImVec2 origin, flo
 	for (int n = 0; n < data->points.size(); n += 2)
 		points.push_back(data->points[n] + origin);
 
-	Eigen::VectorXf t = parametrization(points, parametrizationType);
+	Eigen::VectorXf t = Parametrization::parametrization(points, parametrizationType);
 
 	std::vector<Ubpa::pointf2> tx, ty;
 	for (int i = 0; i < points.size(); ++i) {
@@ -390,7 +486,7 @@ void plot_AL(ImVec2* p, CanvasData* data, int& p_index, const ImVec2 origin, int
 		points.push_back(data->points[n] + origin);
 
 	//parametrization
-	Eigen::VectorXf t = parametrization(points, parametrizationType);
+	Eigen::VectorXf t = Parametrization::parametrization(points, parametrizationType);
 
 	std::vector<Ubpa::pointf2> tx, ty;
 	for (int i = 0; i < points.size(); ++i) {
@@ -419,7 +515,7 @@ void plot_AR(ImVec2* p, CanvasData* data, int& p_index, const ImVec2 origin, int
 		points.push_back(data->points[n] + origin);
 
 	//parametrization
-	Eigen::VectorXf t = parametrization(points, parametrizationType);
+	Eigen::VectorXf t = Parametrization::parametrization(points, parametrizationType);
 
 	std::vector<Ubpa::pointf2> tx, ty;
 	for (int i = 0; i < points.size(); ++i) {
@@ -440,20 +536,4 @@ void plot_AR(ImVec2* p, CanvasData* data, int& p_index, const ImVec2 origin, int
 		}
 		p[p_index++] = ImVec2(fx, fy);
 	}
-}
-
-Eigen::VectorXf parametrization(std::vector<Ubpa::pointf2> points, int parametrizationType) {
-	//parametrization
-	switch (parametrizationType) {
-	case 0:
-		return Parametrization::chordParameterization(points);
-	case 1:
-		return Parametrization::centripetalParameterization(points);
-	case 2:
-		return Parametrization::uniformParameterization(points.size());
-	case 3:
-		return Parametrization::FoleyParameterization(points);
-	default:
-		return Parametrization::chordParameterization(points);
-	}
 }
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "CurveSystem.h"
+
+#include "../Components/CurveData.h"
+
+#include"../Fitting/fitting.h"
+#include "../Parametrization/parametrization.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace Ubpa;
+
+constexpr auto CURVE_SAMPLES = 1001;	// ÿߵĲ뻭ڱ༭ͬ
+
+//  t  [0, 1] ϾȲ (x(t), y(t))
+template<typename F>
+std::vector<Ubpa::pointf2> samplePolyline(F&& f) {
+	std::vector<Ubpa::pointf2> polyline(CURVE_SAMPLES);
+	for (int i = 0; i < CURVE_SAMPLES; ++i)
+		polyline[i] = f(static_cast<float>(i) / (CURVE_SAMPLES - 1));
+	return polyline;
+}
+
+// ʽ \sum c_j t^j
+float polynomial(const Eigen::VectorXf& c, float t) {
+	float ft = 0;
+	for (int j = 0; j < c.size(); ++j)
+		ft += c[j] * powf(t, j);
+	return ft;
+}
+
+void CurveSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
+	schedule.RegisterCommand([](Ubpa::UECS::World* w) {
+		// ֻδߡʽ Gauss ϲݵ͹ڣǰòΧУ
+		// Բ޳ʵ岻޸ģÿֻһ
+		w->RunEntityJob([](const CurveKnots* knots, CurveTessellation* tess) {
+			if (tess->version == knots->version)
+				return;
+			std::vector<Ubpa::pointf2> points;
+			for (int n = 0; n < knots->points.size(); n += 2)
+				points.push_back(knots->points[n]);
+
+			tess->polylines.clear();
+			if (points.size() > 1) {
+				Eigen::VectorXf t = Parametrization::parametrization(points, knots->parametrizationType);
+				std::vector<Ubpa::pointf2> tx, ty;
+				for (int i = 0; i < points.size(); ++i) {
+					tx.push_back(Ubpa::pointf2(t[i], points[i][0]));
+					ty.push_back(Ubpa::pointf2(t[i], points[i][1]));
+				}
+
+				if (knots->enable_IP) {
+					Eigen::VectorXf cx = Fitting::Interpolation_PolynomialBaseFunction(tx);
+					Eigen::VectorXf cy = Fitting::Interpolation_PolynomialBaseFunction(ty);
+					tess->polylines.push_back(samplePolyline([&](float t_i) { return Ubpa::pointf2(polynomial(cx, t_i), polynomial(cy, t_i)); }));
+				}
+				if (knots->enable_IG) {
+					const float sigma = knots->sigma;
+					Eigen::VectorXf cx = Fitting::Interpolation_GaussBaseFunction(tx, sigma);
+					Eigen::VectorXf cy = Fitting::Interpolation_GaussBaseFunction(ty, sigma);
+					tess->polylines.push_back(samplePolyline([&](float t_i) {
+						float fx = cx[0], fy = cy[0];
+						for (int j = 1; j < cx.size(); ++j) {
+							fx += cx[j] * expf(-(t_i - t[j - 1]) * (t_i - t[j - 1]) / (2 * sigma * sigma));
+							fy += cy[j] * expf(-(t_i - t[j - 1]) * (t_i - t[j - 1]) / (2 * sigma * sigma));
+						}
+						return Ubpa::pointf2(fx, fy);
+					}));
+				}
+				if (knots->enable_ALS) {
+					Eigen::VectorXf cx = Fitting::Approximation_LeastSquare(tx, knots->order_als);
+					Eigen::VectorXf cy = Fitting::Approximation_LeastSquare(ty, knots->order_als);
+					tess->polylines.push_back(samplePolyline([&](float t_i) { return Ubpa::pointf2(polynomial(cx, t_i), polynomial(cy, t_i)); }));
+				}
+				if (knots->enable_ARR) {
+					Eigen::VectorXf cx = Fitting::Approximation_RidgeRegression(tx, knots->order_arr, knots->lambda);
+					Eigen::VectorXf cy = Fitting::Approximation_RidgeRegression(ty, knots->order_arr, knots->lambda);
+					tess->polylines.push_back(samplePolyline([&](float t_i) { return Ubpa::pointf2(polynomial(cx, t_i), polynomial(cy, t_i)); }));
+				}
+			}
+			// ûϽʱݵߣԿɼѡȡ
+			if (tess->polylines.empty())
+				tess->polylines.push_back(points);
+
+			tess->lo = Ubpa::pointf2(FLT_MAX, FLT_MAX);
+			tess->hi = Ubpa::pointf2(-FLT_MAX, -FLT_MAX);
+			for (const auto& polyline : tess->polylines) {
+				for (const auto& p : polyline) {
+					tess->lo = Ubpa::pointf2(std::min(tess->lo[0], p[0]), std::min(tess->lo[1], p[1]));
+					tess->hi = Ubpa::pointf2(std::max(tess->hi[0], p[0]), std::max(tess->hi[1], p[1]));
+				}
+			}
+			tess->version = knots->version;
+		});
+	});
+}
@@ -2,10 +2,28 @@
 
 #include <UGM/UGM.h>
 
+// һύı༭ֻ¼仯Ĳ֣ڳ
+struct CanvasEdit {
+	enum Type { MOVE_KNOT, SET_HANDLE, ADD_KNOT, REMOVE_KNOT, REPLACE_ALL };
+	Type type;
+	int index{ -1 };	// MOVE_KNOT / SET_HANDLE ݵ±
+	Ubpa::pointf2 knot[2];	// ༭ǰλãADD_KNOT / REMOVE_KNOT ֻ knot[0]
+	std::pair<Ubpa::pointf2, Ubpa::pointf2> handle[2];	// ༭ǰֱADD_KNOT / REMOVE_KNOT ֻ handle[0]
+	int vertexType{ 0 };	// ADD_KNOT / REMOVE_KNOT Ķģʽ
+
+	// REPLACE_ALL롢ȫɾʱ༭ǰ
+	std::vector<Ubpa::pointf2> points[2];
+	std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>> derivative[2];
+	std::vector<int> vertexTypes[2];
+	bool hermite[2]{ false, false };	// ༭ǰֱǷЧvalidDerivative
+};
+
 struct CanvasData {
 	std::vector<Ubpa::pointf2> points;
 	std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>> derivative;
 	Ubpa::valf2 scrolling{ 0.f,0.f };
+	Ubpa::valf2 viewMin{ 0.f,0.f };	// ɼ򣨻꣩޳
+	Ubpa::valf2 viewMax{ 0.f,0.f };
 	bool opt_enable_grid{ false };
 	bool opt_enable_context_menu{ true };
 
@@ -13,11 +31,13 @@ struct CanvasData {
 
 	bool importData{ false };
 	bool exportData{ false };
+	bool undo{ false };
+	bool redo{ false };
 
 	bool isEnd{ false };
 
-	std::vector<float> _mx;
-	std::vector<float> _my;
+	std::vector<CanvasEdit> undoStack;
+	std::vector<CanvasEdit> redoStack;
 };
 
 #include "details/CanvasData_AutoRefl.inl"
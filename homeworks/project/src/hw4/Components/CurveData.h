@@ -0,0 +1,32 @@
+#pragma once
+
+#include <UGM/UGM.h>
+#include "../Curve/splinemodel.h"
+
+// ϳڱ༭⣬ÿһʵ壬
+
+// ݵֱʵ彨ú޸ģȡػ༭ʱʵ屻ɾʱ½ʵ壬
+//  version Ϊ 1 version Ϊ 0 ʾδ
+struct CurveKnots {
+	std::vector<Ubpa::pointf2> points;
+	std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>> derivative;
+	int parametrizationType = 0;
+	bool hermite{ false };
+	unsigned version{ 1 };
+};
+
+// ģͼ Bezier ƵΧУversion  CurveKnots ͬʾͬ
+struct CurveSpline {
+	Curve::SplineModel model;
+	Ubpa::pointf2 lo{ 0.f,0.f };
+	Ubpa::pointf2 hi{ 0.f,0.f };
+	unsigned version{ 0 };
+};
+
+// ϸֽ棬version  CurveKnots ͬʾЧΧڻʱϸ
+struct CurveTessellation {
+	std::vector<Ubpa::pointf2> vertices;
+	unsigned version{ 0 };
+};
+
+#include "details/CurveData_AutoRefl.inl"
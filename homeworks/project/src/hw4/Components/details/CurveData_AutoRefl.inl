@@ -0,0 +1,67 @@
+// This file is generated by Ubpa::USRefl::AutoRefl
+
+#pragma once
+
+#include <USRefl/USRefl.h>
+
+template<>
+struct Ubpa::USRefl::TypeInfo<CurveKnots> :
+    TypeInfoBase<CurveKnots>
+{
+#ifdef UBPA_USREFL_NOT_USE_NAMEOF
+    static constexpr char name[11] = "CurveKnots";
+#endif
+    static constexpr AttrList attrs = {};
+    static constexpr FieldList fields = {
+        Field {TSTR("points"), &Type::points},
+        Field {TSTR("derivative"), &Type::derivative},
+        Field {TSTR("parametrizationType"), &Type::parametrizationType, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 0; }},
+        }},
+        Field {TSTR("hermite"), &Type::hermite, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("version"), &Type::version, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->unsigned{ return { 1 }; }},
+        }},
+    };
+};
+
+template<>
+struct Ubpa::USRefl::TypeInfo<CurveSpline> :
+    TypeInfoBase<CurveSpline>
+{
+#ifdef UBPA_USREFL_NOT_USE_NAMEOF
+    static constexpr char name[12] = "CurveSpline";
+#endif
+    static constexpr AttrList attrs = {};
+    static constexpr FieldList fields = {
+        Field {TSTR("model"), &Type::model},
+        Field {TSTR("lo"), &Type::lo, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->Ubpa::pointf2{ return { 0.f,0.f }; }},
+        }},
+        Field {TSTR("hi"), &Type::hi, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->Ubpa::pointf2{ return { 0.f,0.f }; }},
+        }},
+        Field {TSTR("version"), &Type::version, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->unsigned{ return { 0 }; }},
+        }},
+    };
+};
+
+template<>
+struct Ubpa::USRefl::TypeInfo<CurveTessellation> :
+    TypeInfoBase<CurveTessellation>
+{
+#ifdef UBPA_USREFL_NOT_USE_NAMEOF
+    static constexpr char name[18] = "CurveTessellation";
+#endif
+    static constexpr AttrList attrs = {};
+    static constexpr FieldList fields = {
+        Field {TSTR("vertices"), &Type::vertices},
+        Field {TSTR("version"), &Type::version, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->unsigned{ return { 0 }; }},
+        }},
+    };
+};
+
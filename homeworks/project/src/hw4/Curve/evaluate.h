@@ -0,0 +1,127 @@
+#pragma once
+#include <cmath>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define CURVE_EVALUATE_SSE
+#endif
+
+/**********************************************************************************
+/// @file       evaluate.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ߶εֵ
+/// @details    һαͬʱλáһ׵׵ʣ SoA ţ
+///             ֱӦͬһݽظֵ
+**********************************************************************************/
+
+namespace Curve {
+	// ֵ±һһӦ
+	struct CurveSamples {
+		std::vector<float> t;
+		std::vector<float> x, y;		// λ
+		std::vector<float> dx, dy;		// һ׵
+		std::vector<float> ddx, ddy;	// ׵
+		std::vector<float> curvature;	// ʣʱΪ
+		std::vector<float> arcLength;	// Եһۼƻ
+
+		void Resize(int n) {
+			for (auto* v : { &t, &x, &y, &dx, &dy, &ddx, &ddy, &curvature, &arcLength })
+				v->resize(n);
+		}
+
+		int Size() const { return static_cast<int>(t.size()); }
+	};
+
+	/*
+	/// @brief      ˵һ׵
+	/// @details     M0, M1 γ h õ
+	/// @param[in]  : p0, p1 : ˵
+	/// @return
+	/// @attention  δһĲ
+	*/
+	inline void splineEndDerivatives(float p0, float p1, float M0, float M1, float h, float& d0, float& d1) {
+		float slope = (p1 - p0) / h;
+		d0 = slope - M0 * h / 3.0f - M1 * h / 6.0f;
+		d1 = slope + M0 * h / 6.0f + M1 * h / 3.0f;
+	}
+
+	/*
+	/// @brief      һζʽֵ
+	/// @details    p(s) = c0 + c1 s + c2 s^2 + c3 s^3s = t - t0SSE һδ 4 
+	/// @param[in]  : t :     n :     dscale : 㵽ıds/du
+	///               out : д [offset, offset + n)
+	/// @return
+	/// @attention  out Ԥ Resize㣬 accumulateArcLength
+	*/
+	inline void evaluateCubicBatch(const float cx[4], const float cy[4], float t0, const float* t, int n, float dscale, CurveSamples* out, int offset) {
+		float* X = out->x.data() + offset;
+		float* Y = out->y.data() + offset;
+		float* DX = out->dx.data() + offset;
+		float* DY = out->dy.data() + offset;
+		float* DDX = out->ddx.data() + offset;
+		float* DDY = out->ddy.data() + offset;
+		float* K = out->curvature.data() + offset;
+		const float eps = 1E-12f;
+		int k = 0;
+#ifdef CURVE_EVALUATE_SSE
+		const __m128 vt0 = _mm_set1_ps(t0);
+		const __m128 s1 = _mm_set1_ps(dscale), s2 = _mm_set1_ps(dscale * dscale);
+		const __m128 ax0 = _mm_set1_ps(cx[0]), ax1 = _mm_set1_ps(cx[1]), ax2 = _mm_set1_ps(cx[2]), ax3 = _mm_set1_ps(cx[3]);
+		const __m128 ay0 = _mm_set1_ps(cy[0]), ay1 = _mm_set1_ps(cy[1]), ay2 = _mm_set1_ps(cy[2]), ay3 = _mm_set1_ps(cy[3]);
+		const __m128 two = _mm_set1_ps(2.0f), three = _mm_set1_ps(3.0f), six = _mm_set1_ps(6.0f), veps = _mm_set1_ps(eps);
+		for (; k + 4 <= n; k += 4) {
+			__m128 s = _mm_sub_ps(_mm_loadu_ps(t + k), vt0);
+			// λ
+			__m128 px = _mm_add_ps(ax0, _mm_mul_ps(s, _mm_add_ps(ax1, _mm_mul_ps(s, _mm_add_ps(ax2, _mm_mul_ps(s, ax3))))));
+			__m128 py = _mm_add_ps(ay0, _mm_mul_ps(s, _mm_add_ps(ay1, _mm_mul_ps(s, _mm_add_ps(ay2, _mm_mul_ps(s, ay3))))));
+			// һ׵ c1 + 2 c2 s + 3 c3 s^2
+			__m128 vx = _mm_add_ps(ax1, _mm_mul_ps(s, _mm_add_ps(_mm_mul_ps(two, ax2), _mm_mul_ps(three, _mm_mul_ps(s, ax3)))));
+			__m128 vy = _mm_add_ps(ay1, _mm_mul_ps(s, _mm_add_ps(_mm_mul_ps(two, ay2), _mm_mul_ps(three, _mm_mul_ps(s, ay3)))));
+			// ׵ 2 c2 + 6 c3 s
+			__m128 wx = _mm_add_ps(_mm_mul_ps(two, ax2), _mm_mul_ps(six, _mm_mul_ps(s, ax3)));
+			__m128 wy = _mm_add_ps(_mm_mul_ps(two, ay2), _mm_mul_ps(six, _mm_mul_ps(s, ay3)));
+			vx = _mm_mul_ps(vx, s1); vy = _mm_mul_ps(vy, s1);
+			wx = _mm_mul_ps(wx, s2); wy = _mm_mul_ps(wy, s2);
+			//  (x'y'' - y'x'') / |v|^3ٶΪ 0  0
+			__m128 v2 = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+			__m128 cross = _mm_sub_ps(_mm_mul_ps(vx, wy), _mm_mul_ps(vy, wx));
+			__m128 v3 = _mm_mul_ps(v2, _mm_sqrt_ps(v2));
+			__m128 kappa = _mm_and_ps(_mm_div_ps(cross, _mm_max_ps(v3, veps)), _mm_cmpgt_ps(v3, veps));
+			_mm_storeu_ps(X + k, px); _mm_storeu_ps(Y + k, py);
+			_mm_storeu_ps(DX + k, vx); _mm_storeu_ps(DY + k, vy);
+			_mm_storeu_ps(DDX + k, wx); _mm_storeu_ps(DDY + k, wy);
+			_mm_storeu_ps(K + k, kappa);
+		}
+#endif
+		for (; k < n; ++k) {
+			float s = t[k] - t0;
+			X[k] = cx[0] + s * (cx[1] + s * (cx[2] + s * cx[3]));
+			Y[k] = cy[0] + s * (cy[1] + s * (cy[2] + s * cy[3]));
+			float vx = (cx[1] + s * (2.0f * cx[2] + 3.0f * s * cx[3])) * dscale;
+			float vy = (cy[1] + s * (2.0f * cy[2] + 3.0f * s * cy[3])) * dscale;
+			float wx = (2.0f * cx[2] + 6.0f * s * cx[3]) * dscale * dscale;
+			float wy = (2.0f * cy[2] + 6.0f * s * cy[3]) * dscale * dscale;
+			float v2 = vx * vx + vy * vy;
+			float v3 = v2 * sqrtf(v2);
+			DX[k] = vx; DY[k] = vy;
+			DDX[k] = wx; DDY[k] = wy;
+			K[k] = v3 > eps ? (vx * wy - vy * wx) / v3 : 0.0f;
+		}
+	}
+
+	// ٶȵιʽۼƻ
+	inline void accumulateArcLength(CurveSamples* out) {
+		int n = out->Size();
+		if (n == 0)
+			return;
+		out->arcLength[0] = 0.0f;
+		float prev = sqrtf(out->dx[0] * out->dx[0] + out->dy[0] * out->dy[0]);
+		for (int k = 1; k < n; ++k) {
+			float speed = sqrtf(out->dx[k] * out->dx[k] + out->dy[k] * out->dy[k]);
+			out->arcLength[k] = out->arcLength[k - 1] + 0.5f * (prev + speed) * (out->t[k] - out->t[k - 1]);
+			prev = speed;
+		}
+	}
+}
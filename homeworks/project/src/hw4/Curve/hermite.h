@@ -0,0 +1,128 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "evaluate.h"
+
+#include <array>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define CURVE_HERMITE_SSE
+#endif
+
+/**********************************************************************************
+/// @file       hermite.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief       Hermite ϵ
+/// @details    ༭ֱÿ˵λ뵼ΨһȷֱӸʽϵ
+///             ٶÿ 4x4 Է
+**********************************************************************************/
+
+namespace Curve {
+	/*
+	/// @brief      Hermite εıʽϵ
+	/// @details     s = t - t0 ΪԱp(s) = c0 + c1 s + c2 s^2 + c3 s^3
+	/// @param[in]  : p0, p1 : ˵    d0, d1 : ˵㴦һ׵    h : t1 - t0
+	/// @return
+	/// @attention
+	*/
+	inline void hermiteCoefficients(float p0, float p1, float d0, float d1, float h, float c[4]) {
+		float delta = (p1 - p0) / h;
+		c[0] = p0;
+		c[1] = d0;
+		c[2] = (3.0f * delta - 2.0f * d0 - d1) / h;
+		c[3] = (d0 + d1 - 2.0f * delta) / (h * h);
+	}
+
+	class HermiteCache {
+	public:
+		// µ i Σδʱֱӷ false
+		bool UpdateSegment(int i, const Ubpa::pointf2& p0, const Ubpa::pointf2& p1, const Ubpa::pointf2& d0, const Ubpa::pointf2& d1, float t0, float t1) {
+			Key key{ { p0[0], p0[1], p1[0], p1[1], d0[0], d0[1], d1[0], d1[1], t0, t1 } };
+			if (valid[i] && key == keys[i])
+				return false;
+			keys[i] = key;
+			valid[i] = true;
+
+			float h = t1 - t0;
+			float c[4];
+			hermiteCoefficients(p0[0], p1[0], d0[0], d1[0], h, c);
+			cx0[i] = c[0]; cx1[i] = c[1]; cx2[i] = c[2]; cx3[i] = c[3];
+			hermiteCoefficients(p0[1], p1[1], d0[1], d1[1], h, c);
+			cy0[i] = c[0]; cy1[i] = c[1]; cy2[i] = c[2]; cy3[i] = c[3];
+			ts[i] = t0;
+			return true;
+		}
+
+		void Resize(int numSegments) {
+			if (numSegments == NumSegments())
+				return;
+			keys.resize(numSegments);
+			valid.resize(numSegments, false);
+			for (auto* v : { &ts, &cx0, &cx1, &cx2, &cx3, &cy0, &cy1, &cy2, &cy3 })
+				v->resize(numSegments);
+		}
+
+		void Clear() { Resize(0); }
+
+		int NumSegments() const { return static_cast<int>(keys.size()); }
+
+		/*
+		/// @brief       i  n λ
+		/// @details    Horner ֵSSE һδ 4 
+		/// @param[in]  : t :     x, y : 
+		/// @return
+		/// @attention
+		*/
+		void EvaluateBatch(int i, const float* t, int n, float* x, float* y) const {
+			int k = 0;
+#ifdef CURVE_HERMITE_SSE
+			const __m128 t0 = _mm_set1_ps(ts[i]);
+			const __m128 ax0 = _mm_set1_ps(cx0[i]), ax1 = _mm_set1_ps(cx1[i]), ax2 = _mm_set1_ps(cx2[i]), ax3 = _mm_set1_ps(cx3[i]);
+			const __m128 ay0 = _mm_set1_ps(cy0[i]), ay1 = _mm_set1_ps(cy1[i]), ay2 = _mm_set1_ps(cy2[i]), ay3 = _mm_set1_ps(cy3[i]);
+			for (; k + 4 <= n; k += 4) {
+				__m128 s = _mm_sub_ps(_mm_loadu_ps(t + k), t0);
+				__m128 vx = _mm_add_ps(ax2, _mm_mul_ps(s, ax3));
+				__m128 vy = _mm_add_ps(ay2, _mm_mul_ps(s, ay3));
+				vx = _mm_add_ps(ax1, _mm_mul_ps(s, vx));
+				vy = _mm_add_ps(ay1, _mm_mul_ps(s, vy));
+				_mm_storeu_ps(x + k, _mm_add_ps(ax0, _mm_mul_ps(s, vx)));
+				_mm_storeu_ps(y + k, _mm_add_ps(ay0, _mm_mul_ps(s, vy)));
+			}
+#endif
+			for (; k < n; ++k) {
+				float s = t[k] - ts[i];
+				x[k] = cx0[i] + s * (cx1[i] + s * (cx2[i] + s * cx3[i]));
+				y[k] = cy0[i] + s * (cy1[i] + s * (cy2[i] + s * cy3[i]));
+			}
+		}
+
+		/*
+		/// @brief       i  n λá
+		/// @details    
+		/// @param[in]  : dscale : 㵽ı    out : д [offset, offset + n)
+		/// @return
+		/// @attention
+		*/
+		void EvaluateBatch(int i, const float* t, int n, float dscale, CurveSamples* out, int offset) const {
+			const float cx[4] = { cx0[i], cx1[i], cx2[i], cx3[i] };
+			const float cy[4] = { cy0[i], cy1[i], cy2[i], cy3[i] };
+			evaluateCubicBatch(cx, cy, ts[i], t, n, dscale, out, offset);
+		}
+
+	private:
+		struct Key {
+			std::array<float, 10> v;	// p0, p1, d0, d1, t0, t1
+			bool operator==(const Key& rhs) const { return v == rhs.v; }
+		};
+
+		std::vector<Key> keys;
+		std::vector<bool> valid;
+
+		// SoA ϵ
+		std::vector<float> ts;
+		std::vector<float> cx0, cx1, cx2, cx3;
+		std::vector<float> cy0, cy1, cy2, cy3;
+	};
+}
@@ -0,0 +1,279 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "splinemodel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**********************************************************************************
+/// @file       spatialindex.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ʰȡõľ
+/// @details    ݵ㡢ֱϸְΧзֱУ SplineModel ı仯£
+///             ͣѡֻʲѯ򸲸ǵĸӣݵ޹
+**********************************************************************************/
+
+namespace Curve {
+	struct Box {
+		Ubpa::pointf2 lo, hi;
+
+		static Box Around(const Ubpa::pointf2& p, float radius) {
+			return { Ubpa::pointf2(p[0] - radius, p[1] - radius), Ubpa::pointf2(p[0] + radius, p[1] + radius) };
+		}
+
+		bool Contains(const Ubpa::pointf2& p) const {
+			return p[0] >= lo[0] && p[0] <= hi[0] && p[1] >= lo[1] && p[1] <= hi[1];
+		}
+	};
+
+	class SpatialGrid {
+	public:
+		explicit SpatialGrid(float cellSize = 32.0f) : cellSize(cellSize) {}
+
+		void Clear() {
+			cells.clear();
+			boxes.clear();
+			present.clear();
+			visited.clear();
+		}
+
+		// ƶ id 
+		void Set(int id, const Box& box) {
+			if (id >= static_cast<int>(boxes.size())) {
+				boxes.resize(id + 1);
+				present.resize(id + 1, false);
+				visited.resize(id + 1, 0);
+			}
+			if (present[id]) {
+				if (cellRange(boxes[id]) == cellRange(box)) {
+					boxes[id] = box;
+					return;
+				}
+				Remove(id);
+			}
+			boxes[id] = box;
+			present[id] = true;
+			forEachCell(box, [&](uint64_t key) { cells[key].push_back(id); });
+		}
+
+		void Remove(int id) {
+			if (id >= static_cast<int>(boxes.size()) || !present[id])
+				return;
+			forEachCell(boxes[id], [&](uint64_t key) {
+				auto it = cells.find(key);
+				auto& ids = it->second;
+				ids.erase(std::find(ids.begin(), ids.end(), id));
+				if (ids.empty())
+					cells.erase(it);
+			});
+			present[id] = false;
+		}
+
+		// ɾ id >= n Ķ
+		void Truncate(int n) {
+			for (int id = n; id < static_cast<int>(boxes.size()); ++id)
+				Remove(id);
+			if (n < static_cast<int>(boxes.size())) {
+				boxes.resize(n);
+				present.resize(n);
+				visited.resize(n);
+			}
+		}
+
+		const Box& BoxOf(int id) const { return boxes[id]; }
+
+		/*
+		/// @brief      ԰Χ box ཻÿһ f(id)
+		/// @details    ӵĶ÷ʱȥ
+		/// @param[in]  :
+		/// @return
+		/// @attention
+		*/
+		template<typename Fun>
+		void Query(const Box& box, Fun&& f) const {
+			if (++stamp == 0) {
+				std::fill(visited.begin(), visited.end(), 0);
+				stamp = 1;
+			}
+			forEachCell(box, [&](uint64_t key) {
+				auto it = cells.find(key);
+				if (it == cells.end())
+					return;
+				for (int id : it->second) {
+					if (visited[id] == stamp)
+						continue;
+					visited[id] = stamp;
+					const Box& b = boxes[id];
+					if (b.lo[0] <= box.hi[0] && b.hi[0] >= box.lo[0] && b.lo[1] <= box.hi[1] && b.hi[1] >= box.lo[1])
+						f(id);
+				}
+			});
+		}
+
+	private:
+		struct CellRange {
+			int x0, y0, x1, y1;
+			bool operator==(const CellRange& rhs) const { return x0 == rhs.x0 && y0 == rhs.y0 && x1 == rhs.x1 && y1 == rhs.y1; }
+		};
+
+		CellRange cellRange(const Box& box) const {
+			return { static_cast<int>(floorf(box.lo[0] / cellSize)), static_cast<int>(floorf(box.lo[1] / cellSize)),
+				static_cast<int>(floorf(box.hi[0] / cellSize)), static_cast<int>(floorf(box.hi[1] / cellSize)) };
+		}
+
+		template<typename Fun>
+		void forEachCell(const Box& box, Fun&& f) const {
+			CellRange r = cellRange(box);
+			for (int y = r.y0; y <= r.y1; ++y)
+				for (int x = r.x0; x <= r.x1; ++x)
+					f((static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | static_cast<uint32_t>(x));
+		}
+
+		float cellSize;
+		std::unordered_map<uint64_t, std::vector<int>> cells;
+		std::vector<Box> boxes;
+		std::vector<bool> present;
+		mutable std::vector<unsigned> visited;
+		mutable unsigned stamp{ 0 };
+	};
+
+	// ϵ
+	struct CurvePick {
+		int segment{ -1 };
+		Ubpa::pointf2 point;
+		float distance{ 0.0f };
+	};
+
+	class PickIndex {
+	public:
+		/*
+		/// @brief       SplineModel ı仯
+		/// @details    ģȫؽʱؽֻ±仯ݵ㡢ϸֵĶμĩβɾĵ
+		/// @param[in]  : handleScale : ֱ =  / handleScale뻭һ
+		/// @return
+		/// @attention  ֻ Hermite ģʽֱģʽĵ϶úģ͵ı仯¼
+		*/
+		void Update(SplineModel& model, float handleScale) {
+			scale = handleScale;
+			if (model.Rebuilt()) {
+				knotGrid.Clear();
+				handleGrid.Clear();
+				segmentGrid.Clear();
+				for (int i = 0; i < model.NumKnots(); ++i)
+					setKnot(model, i);
+			}
+			else {
+				// ĩβɾĵ
+				knotGrid.Truncate(model.NumKnots());
+				handleGrid.Truncate(2 * model.NumKnots());
+				segmentGrid.Truncate(model.NumSegments());
+				for (int i : model.ChangedKnots()) {
+					if (i < model.NumKnots())
+						setKnot(model, i);
+				}
+			}
+			for (int j : model.ChangedSegments()) {
+				if (j < model.NumSegments())
+					setSegment(model, j);
+			}
+			model.ClearChanges();
+		}
+
+		// radius ݵ㣬ûʱ -1
+		int PickKnot(const Ubpa::pointf2& p, float radius) const {
+			return nearest(knotGrid, p, radius, -1);
+		}
+
+		/*
+		/// @brief      radius ֱ
+		/// @details
+		/// @param[in]  : knot : ֻǸݵֱ-1 ʾ
+		/// @return     2i Ϊ i ֱ2i+1 Ϊֱûʱ -1
+		/// @attention
+		*/
+		int PickHandle(const Ubpa::pointf2& p, float radius, int knot = -1) const {
+			return nearest(handleGrid, p, radius, knot);
+		}
+
+		/*
+		/// @brief      Ͼ p ĵ
+		/// @details    ֻΧѯཻĶΣڻĶ㴮㵽ߵľ
+		/// @param[in]  :
+		/// @return     segment Ϊ -1 ʾ radius û
+		/// @attention
+		*/
+		CurvePick NearestOnCurve(const SplineModel& model, const Ubpa::pointf2& p, float radius) const {
+			CurvePick pick;
+			float best = radius * radius;
+			segmentGrid.Query(Box::Around(p, radius), [&](int j) {
+				const auto& run = model.Run(j);
+				for (int k = 0; k + 1 < static_cast<int>(run.size()); ++k) {
+					Ubpa::vecf2 e = run[k + 1] - run[k];
+					float len2 = e.norm2();
+					float u = len2 > 0.0f ? std::min(std::max((p - run[k]).dot(e) / len2, 0.0f), 1.0f) : 0.0f;
+					Ubpa::pointf2 q = run[k] + e * u;
+					float d2 = (p - q).norm2();
+					if (d2 <= best) {
+						best = d2;
+						pick.segment = j;
+						pick.point = q;
+					}
+				}
+			});
+			pick.distance = sqrtf(best);
+			return pick;
+		}
+
+		// ѡ box ڵݵ㣬±
+		void QueryKnots(const Box& box, std::vector<int>* out) const {
+			out->clear();
+			knotGrid.Query(box, [&](int i) { out->push_back(i); });
+			std::sort(out->begin(), out->end());
+		}
+
+	private:
+		void setKnot(const SplineModel& model, int i) {
+			const Ubpa::pointf2& p = model.Knot(i);
+			knotGrid.Set(i, Box::Around(p, 0.0f));
+			if (!model.IsHermite())
+				return;
+			const auto& d = model.Handle(i);
+			handleGrid.Set(2 * i, Box::Around(Ubpa::pointf2(p[0] - d.first[0] / scale, p[1] - d.first[1] / scale), 0.0f));
+			handleGrid.Set(2 * i + 1, Box::Around(Ubpa::pointf2(p[0] + d.second[0] / scale, p[1] + d.second[1] / scale), 0.0f));
+		}
+
+		void setSegment(const SplineModel& model, int j) {
+			const auto& run = model.Run(j);
+			Box box{ run.front(), run.front() };
+			for (const auto& v : run) {
+				box.lo = Ubpa::pointf2(std::min(box.lo[0], v[0]), std::min(box.lo[1], v[1]));
+				box.hi = Ubpa::pointf2(std::max(box.hi[0], v[0]), std::max(box.hi[1], v[1]));
+			}
+			segmentGrid.Set(j, box);
+		}
+
+		static int nearest(const SpatialGrid& grid, const Ubpa::pointf2& p, float radius, int owner) {
+			int result = -1;
+			float best = radius * radius;
+			grid.Query(Box::Around(p, radius), [&](int id) {
+				if (owner >= 0 && id / 2 != owner)
+					return;
+				float d2 = (p - grid.BoxOf(id).lo).norm2();
+				if (d2 < best) {
+					best = d2;
+					result = id;
+				}
+			});
+			return result;
+		}
+
+		float scale{ 1.0f };
+		SpatialGrid knotGrid;
+		SpatialGrid handleGrid;
+		SpatialGrid segmentGrid;
+	};
+}
@@ -0,0 +1,545 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "hermite.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+/**********************************************************************************
+/// @file       splinemodel.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      αǵģ
+/// @details    ÿλһϸֶ㣬ֻܱ༭ӰĶβϸ֣
+///             ϶ֱֻӰΣ϶ݵʱط״ֲ⣬
+///             ر仯뼸˥˥ֵ¼ֹͣ
+**********************************************************************************/
+
+namespace Curve {
+	class SplineModel {
+	public:
+		float pixelTolerance = 0.1f;	// ֲĽضֵأ
+		float sampleSpacing = 2.0f;		// ϸֲࣨأ
+
+		/*
+		/// @brief      ȫؽ
+		/// @details
+		/// @param[in]  : hermite : true ʾֱѱ༭ Hermite μ㣻Ϊ
+		/// @return
+		/// @attention  derivative Ϊһ t[0,1] µĵ CanvasData һ
+		*/
+		void Reset(const std::vector<Ubpa::pointf2>& points, const std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>>& derivative, bool hermite, int parametrizationType) {
+			knots = points;
+			handles = derivative;
+			isHermite = hermite;
+			type = parametrizationType;
+
+			int n = NumKnots();
+			int m = std::max(n - 1, 0);
+			h.resize(m);
+			for (int i = 0; i < m; ++i)
+				h[i] = interval(i);
+			T = totalLength();
+
+			mx.assign(n, 0.0f);
+			my.assign(n, 0.0f);
+			rx.assign(n, 0.0f);
+			ry.assign(n, 0.0f);
+			dmx.assign(n, 0.0f);
+			dmy.assign(n, 0.0f);
+			cp.assign(n, 0.0f);
+			if (!isHermite && n > 2) {
+				// ش 0 вҶ⼴ȫֽ
+				for (int i = 1; i < n - 1; ++i)
+					residual(i);
+				solveWindow(1, n - 2, 1, n - 2);
+				for (int i = 1; i < n - 1; ++i) {
+					mx[i] = dmx[i];
+					my[i] = dmy[i];
+				}
+			}
+
+			segments.Clear();
+			segments.Resize(m);
+			runs.resize(m);
+			dirty.assign(m, true);
+			drift.assign(m, 0.0f);
+			verticesDirty = true;
+			rebuilt = true;
+			changedKnots.clear();
+			changedSegments.clear();
+		}
+
+		/*
+		/// @brief      뻭ͬ
+		/// @details    ģʽʽ仯ʱȫؽȽϣֻѱ仯ݵֱΪ༭ύ
+		/// @param[in]  :
+		/// @return
+		/// @attention
+		*/
+		void Sync(const std::vector<Ubpa::pointf2>& points, const std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>>& derivative, bool hermite, int parametrizationType) {
+			if (points.size() != knots.size() || derivative.size() != handles.size() || hermite != isHermite || parametrizationType != type) {
+				Reset(points, derivative, hermite, parametrizationType);
+				return;
+			}
+			for (int i = 0; i < NumKnots(); ++i) {
+				if (points[i] != knots[i])
+					MoveKnot(i, points[i]);
+			}
+			if (isHermite) {
+				for (int i = 0; i < NumKnots(); ++i) {
+					if (derivative[i].first != handles[i].first || derivative[i].second != handles[i].second)
+						SetHandle(i, derivative[i]);
+				}
+			}
+		}
+
+		// ֱ仯ֻӰ
+		void SetHandle(int i, const std::pair<Ubpa::pointf2, Ubpa::pointf2>& d) {
+			handles[i] = d;
+			changedKnots.push_back(i);
+			markDirty(i - 1);
+			markDirty(i);
+		}
+
+		/*
+		/// @brief      ƶ k ݵ
+		/// @details    ӰĲ䣻ģʽֻԲвķи
+		///             ڱ߽紦λƵ pixelTolerance ʱֹͣ
+		/// @param[in]  :
+		/// @return
+		/// @attention  Hermite ģʽ¹һõܲȱֲ䣬ɿ Refresh У
+		*/
+		void MoveKnot(int k, const Ubpa::pointf2& p) {
+			knots[k] = p;
+			changedKnots.push_back(k);
+			int n = NumKnots();
+			if (n < 2)
+				return;
+
+			// Foley 䳤ڵļнǣӰ췶Χ
+			int hLo = std::max(k - (type == 3 ? 2 : 1), 0);
+			int hHi = std::min(k + (type == 3 ? 1 : 0), n - 2);
+			for (int j = hLo; j <= hHi; ++j) {
+				h[j] = interval(j);
+				markDirty(j);
+			}
+			markDirty(k - 1);
+			markDirty(k);
+
+			if (isHermite || n <= 2)
+				return;
+
+			relax(std::max(std::min(hLo, k - 1), 1), std::min(std::max(hHi + 1, k + 1), n - 2));
+		}
+
+		/*
+		/// @brief      ĩβ׷һݵ
+		/// @details    ֻչ鲢ƶһķʽֲ⣬ؽ
+		/// @param[in]  : d : µֱHermite ģʽʹ
+		/// @return
+		/// @attention   MoveKnot ͬHermite ģʽܲȱֲ
+		*/
+		void AppendKnot(const Ubpa::pointf2& p, const std::pair<Ubpa::pointf2, Ubpa::pointf2>& d) {
+			knots.push_back(p);
+			handles.push_back(d);
+			for (auto* v : { &mx, &my, &rx, &ry, &dmx, &dmy, &cp })
+				v->push_back(0.0f);
+			int m = NumKnots() - 1;
+			if (m > 0) {
+				h.push_back(1.0f);
+				segments.Resize(m);
+				runs.emplace_back();
+				dirty.push_back(true);
+				drift.push_back(0.0f);
+			}
+			verticesDirty = true;
+			MoveKnot(m, p);
+		}
+
+		/*
+		/// @brief      ɾĩβݵ
+		/// @details    µĩذȻ߽ 0ֻԵڶзֲ̾
+		/// @param[in]  :
+		/// @return
+		/// @attention
+		*/
+		void PopKnot() {
+			knots.pop_back();
+			handles.pop_back();
+			for (auto* v : { &mx, &my, &rx, &ry, &dmx, &dmy, &cp })
+				v->pop_back();
+			int n = NumKnots();
+			if (n == 0)
+				return;
+			mx[n - 1] = 0.0f;
+			my[n - 1] = 0.0f;
+			h.pop_back();
+			segments.Resize(n - 1);
+			runs.pop_back();
+			dirty.pop_back();
+			drift.pop_back();
+			verticesDirty = true;
+			if (n < 2)
+				return;
+			if (type == 3)
+				h[n - 2] = interval(n - 2);
+			markDirty(n - 2);
+			if (isHermite || n <= 2)
+				return;
+			relax(n - 2, n - 2);
+		}
+
+		/*
+		/// @brief      Уֲۼ
+		/// @details    ȫأֻѱ仯ֵĶαࣻHermite ģʽܲȱ仯ʱȫ
+		/// @param[in]  :
+		/// @return
+		/// @attention  O(n)һ϶ʱ
+		*/
+		void Refresh() {
+			int n = NumKnots();
+			for (int i = 0; i < n - 1; ++i)
+				h[i] = interval(i);
+			float total = totalLength();
+			if (isHermite) {
+				if (total != T)
+					std::fill(dirty.begin(), dirty.end(), true);
+				T = total;
+				return;
+			}
+			T = total;
+			if (n <= 2)
+				return;
+			for (int i = 1; i < n - 1; ++i)
+				residual(i);
+			solveWindow(1, n - 2, 1, n - 2);
+			applyMoments(1, n - 2);
+		}
+
+		/*
+		/// @brief      ϸ
+		/// @details    ÿΰ Bezier ƶγȾߵĳ޹
+		/// @param[in]  :
+		/// @return     ϸֵĶ
+		/// @attention
+		*/
+		int Tessellate() {
+			int count = 0;
+			for (int j = 0; j < NumSegments(); ++j) {
+				if (!dirty[j])
+					continue;
+				tessellateSegment(j);
+				dirty[j] = false;
+				drift[j] = 0.0f;
+				++count;
+			}
+			if (count)
+				verticesDirty = true;
+			return count;
+		}
+
+		// ƴӺߣ꣩
+		const std::vector<Ubpa::pointf2>& Vertices() {
+			if (verticesDirty) {
+				vertices.clear();
+				for (int j = 0; j < NumSegments(); ++j)
+					vertices.insert(vertices.end(), runs[j].begin() + (j == 0 ? 0 : 1), runs[j].end());
+				verticesDirty = false;
+			}
+			return vertices;
+		}
+
+		/*
+		/// @brief      ڸݵ㴦һ׵
+		/// @details    㵽һ t[0,1] £ֱл༭ģʽʹ
+		/// @param[in]  : derivative : x,y,x,y
+		/// @return
+		/// @attention  ֻģʽ
+		*/
+		void ExportDerivatives(std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>>* derivative) const {
+			float total = totalLength();
+			for (int j = 0; j < NumSegments(); ++j) {
+				Ubpa::pointf2 d0, d1;
+				splineDerivatives(j, d0, d1);
+				(*derivative)[j].second = Ubpa::pointf2(d0[0] * total, d0[1] * total);
+				(*derivative)[j + 1].first = Ubpa::pointf2(d1[0] * total, d1[1] * total);
+			}
+		}
+
+		/*
+		/// @brief      Ĺһֵ
+		/// @details    ˳ɨΣͬһڵĲһλáһ׵׵ʣۼƻ
+		/// @param[in]  : t : еĲt[0,1]    n : 
+		/// @return
+		/// @attention  ڹһ CanvasData еֱһ£δϸֵλȸϵ
+		*/
+		void Evaluate(const float* t, int n, CurveSamples* out) {
+			out->Resize(n);
+			if (n == 0 || NumSegments() == 0)
+				return;
+			float total = totalLength();
+			float u0 = 0.0f;
+			int k = 0;
+			for (int j = 0; j < NumSegments() && k < n; ++j) {
+				if (dirty[j])
+					updateSegment(j);
+				float u1 = u0 + h[j];
+				int begin = k;
+				us.clear();
+				for (; k < n && (j == NumSegments() - 1 || t[k] * total <= u1); ++k)
+					us.push_back(t[k] * total - u0);
+				if (k > begin)
+					segments.EvaluateBatch(j, us.data(), k - begin, total, out, begin);
+				u0 = u1;
+			}
+			std::copy(t, t + n, out->t.begin());
+			accumulateArcLength(out);
+		}
+
+		/*
+		/// @brief      ߵİΧ
+		/// @details    ȡ Bezier ƵİΧУ߱ڣֻػֱҪϸ
+		/// @param[in]  :
+		/// @return
+		/// @attention  ûݵʱ lo > hi
+		*/
+		void Bounds(Ubpa::pointf2& lo, Ubpa::pointf2& hi) const {
+			lo = Ubpa::pointf2(FLT_MAX, FLT_MAX);
+			hi = Ubpa::pointf2(-FLT_MAX, -FLT_MAX);
+			auto extend = [&](float x, float y) {
+				lo = Ubpa::pointf2(std::min(lo[0], x), std::min(lo[1], y));
+				hi = Ubpa::pointf2(std::max(hi[0], x), std::max(hi[1], y));
+			};
+			for (const auto& p : knots)
+				extend(p[0], p[1]);
+			for (int j = 0; j < NumSegments(); ++j) {
+				Ubpa::pointf2 d0, d1;
+				segmentDerivatives(j, d0, d1);
+				float s = h[j] / 3.0f;
+				extend(knots[j][0] + d0[0] * s, knots[j][1] + d0[1] * s);
+				extend(knots[j + 1][0] - d1[0] * s, knots[j + 1][1] - d1[1] * s);
+			}
+		}
+
+		int NumKnots() const { return static_cast<int>(knots.size()); }
+		int NumSegments() const { return static_cast<int>(h.size()); }
+
+		const Ubpa::pointf2& Knot(int i) const { return knots[i]; }
+		const std::pair<Ubpa::pointf2, Ubpa::pointf2>& Handle(int i) const { return handles[i]; }
+		bool IsHermite() const { return isHermite; }
+		int ParametrizationType() const { return type; }
+		//  j λĶ㴮Tessellate ֮Ч
+		const std::vector<Ubpa::pointf2>& Run(int j) const { return runs[j]; }
+
+		// ϴ ClearChanges ı仯ռ
+		bool Rebuilt() const { return rebuilt; }
+		const std::vector<int>& ChangedKnots() const { return changedKnots; }
+		const std::vector<int>& ChangedSegments() const { return changedSegments; }
+		void ClearChanges() {
+			rebuilt = false;
+			changedKnots.clear();
+			changedSegments.clear();
+		}
+
+	private:
+		void markDirty(int j) {
+			if (j >= 0 && j < NumSegments())
+				dirty[j] = true;
+		}
+
+		//  j δһĲȣ Parametrization еĹʽһ
+		float interval(int j) const {
+			const float eps = 1E-6f;
+			int n = NumKnots();
+			auto dist = [&](int i) { return (knots[i + 1] - knots[i]).norm(); };
+			switch (type) {
+			case 1:
+				return std::max(sqrtf(dist(j)), eps);
+			case 2:
+				return 1.0f;
+			case 3: {
+				auto alpha = [&](int i) {
+					float cosvalue = (knots[i - 1] - knots[i]).cos_theta(knots[i + 1] - knots[i]);
+					cosvalue = std::min(cosvalue, 1.0f);
+					cosvalue = std::max(cosvalue, -1.0f);
+					return std::min(3.1415926535f - acosf(cosvalue), 3.1415926535f / 2);
+				};
+				float d = dist(j);
+				float y = 1.0f;
+				if (j >= 1)
+					y += 1.5f * alpha(j) * dist(j - 1) / (dist(j - 1) + d);
+				if (j + 1 <= n - 2)
+					y += 1.5f * alpha(j + 1) * dist(j + 1) / (d + dist(j + 1));
+				return std::max(d * y, eps);
+			}
+			default:
+				return std::max(dist(j), eps);
+			}
+		}
+
+		float totalLength() const {
+			float total = 0.0f;
+			for (float hi : h)
+				total += hi;
+			return total;
+		}
+
+		/*
+		/// @brief      ȥ [ra, rb] еĲв
+		/// @details    ӿ 4 ʼӱֱڱ߽λƵ pixelTolerance
+		/// @param[in]  :
+		/// @return
+		/// @attention
+		*/
+		void relax(int ra, int rb) {
+			int n = NumKnots();
+			for (int i = ra; i <= rb; ++i)
+				residual(i);
+
+			int lo, hi;
+			for (int w = 4; ; w *= 2) {
+				lo = std::max(1, ra - w);
+				hi = std::min(n - 2, rb + w);
+				solveWindow(lo, hi, ra, rb);
+				if ((lo == 1 || displacement(lo) < pixelTolerance) && (hi == n - 2 || displacement(hi) < pixelTolerance))
+					break;
+			}
+			applyMoments(lo, hi);
+		}
+
+		//  i ط̵Ĳв
+		void residual(int i) {
+			float vx = 6.0f * ((knots[i + 1][0] - knots[i][0]) / h[i] - (knots[i][0] - knots[i - 1][0]) / h[i - 1]);
+			float vy = 6.0f * ((knots[i + 1][1] - knots[i][1]) / h[i] - (knots[i][1] - knots[i - 1][1]) / h[i - 1]);
+			float b = 2.0f * (h[i - 1] + h[i]);
+			rx[i] = vx - (h[i - 1] * mx[i - 1] + b * mx[i] + h[i] * mx[i + 1]);
+			ry[i] = vy - (h[i - 1] * my[i - 1] + b * my[i] + h[i] * my[i + 1]);
+		}
+
+		/*
+		/// @brief      ׷Ϸ󴰿 [lo, hi] ڵ
+		/// @details    Ϊ 0вֻ [ra, rb] ڷ
+		/// @param[in]  :
+		/// @return
+		/// @attention
+		*/
+		void solveWindow(int lo, int hi, int ra, int rb) {
+			for (int i = lo; i <= hi; ++i) {
+				float a = i == lo ? 0.0f : h[i - 1];
+				float m = 2.0f * (h[i - 1] + h[i]) - (i == lo ? 0.0f : a * cp[i - 1]);
+				float r_x = (i >= ra && i <= rb) ? rx[i] : 0.0f;
+				float r_y = (i >= ra && i <= rb) ? ry[i] : 0.0f;
+				cp[i] = h[i] / m;
+				dmx[i] = (r_x - (i == lo ? 0.0f : a * dmx[i - 1])) / m;
+				dmy[i] = (r_y - (i == lo ? 0.0f : a * dmy[i - 1])) / m;
+			}
+			for (int i = hi - 1; i >= lo; --i) {
+				dmx[i] -= cp[i] * dmx[i + 1];
+				dmy[i] -= cp[i] * dmy[i + 1];
+			}
+		}
+
+		// ڶλƹƣ|dM| h^2 max|u^3-u|/6 < |dM| h^2 / 15
+		float displacement(int i) const {
+			float hmax = std::max(h[i - 1], h[i]);
+			return std::max(fabsf(dmx[i]), fabsf(dmy[i])) * hmax * hmax / 15.0f;
+		}
+
+		void applyMoments(int lo, int hi) {
+			for (int i = lo; i <= hi; ++i) {
+				mx[i] += dmx[i];
+				my[i] += dmy[i];
+			}
+			for (int j = lo - 1; j <= hi; ++j) {
+				float dm = 0.0f;
+				if (j >= lo)
+					dm = std::max(dm, std::max(fabsf(dmx[j]), fabsf(dmy[j])));
+				if (j + 1 <= hi)
+					dm = std::max(dm, std::max(fabsf(dmx[j + 1]), fabsf(dmy[j + 1])));
+				// ۼδϸֵλƣС༭Ӻ󳬳ֵ
+				drift[j] += dm * h[j] * h[j] / 15.0f;
+				if (drift[j] >= pixelTolerance)
+					markDirty(j);
+			}
+		}
+
+		//  j ˹δһĵ
+		void splineDerivatives(int j, Ubpa::pointf2& d0, Ubpa::pointf2& d1) const {
+			splineEndDerivatives(knots[j][0], knots[j + 1][0], mx[j], mx[j + 1], h[j], d0[0], d1[0]);
+			splineEndDerivatives(knots[j][1], knots[j + 1][1], my[j], my[j + 1], h[j], d0[1], d1[1]);
+		}
+
+		//  j ˹δһĵ
+		void segmentDerivatives(int j, Ubpa::pointf2& d0, Ubpa::pointf2& d1) const {
+			if (isHermite) {
+				d0 = Ubpa::pointf2(handles[j].second[0] / T, handles[j].second[1] / T);
+				d1 = Ubpa::pointf2(handles[j + 1].first[0] / T, handles[j + 1].first[1] / T);
+			}
+			else
+				splineDerivatives(j, d0, d1);
+		}
+
+		// µ j εϵs[0, h[j]]
+		void updateSegment(int j) {
+			Ubpa::pointf2 d0, d1;
+			segmentDerivatives(j, d0, d1);
+			segments.UpdateSegment(j, knots[j], knots[j + 1], d0, d1, 0.0f, h[j]);
+		}
+
+		void tessellateSegment(int j) {
+			changedSegments.push_back(j);
+			const Ubpa::pointf2& p0 = knots[j];
+			const Ubpa::pointf2& p1 = knots[j + 1];
+			Ubpa::pointf2 d0, d1;
+			segmentDerivatives(j, d0, d1);
+			float hj = h[j];
+			segments.UpdateSegment(j, p0, p1, d0, d1, 0.0f, hj);
+
+			// Bezier ƶγǻϽ
+			float ax = d0[0] * hj / 3.0f, ay = d0[1] * hj / 3.0f;
+			float bx = d1[0] * hj / 3.0f, by = d1[1] * hj / 3.0f;
+			float cx = p1[0] - p0[0] - ax - bx, cy = p1[1] - p0[1] - ay - by;
+			float len = sqrtf(ax * ax + ay * ay) + sqrtf(cx * cx + cy * cy) + sqrtf(bx * bx + by * by);
+			int m = std::min(std::max(static_cast<int>(ceilf(len / sampleSpacing)), 1), 1024);
+
+			ts.resize(m + 1);
+			xs.resize(m + 1);
+			ys.resize(m + 1);
+			for (int k = 0; k <= m; ++k)
+				ts[k] = hj * k / m;
+			segments.EvaluateBatch(j, ts.data(), m + 1, xs.data(), ys.data());
+
+			runs[j].resize(m + 1);
+			for (int k = 0; k <= m; ++k)
+				runs[j][k] = Ubpa::pointf2(xs[k], ys[k]);
+			runs[j].front() = p0;
+			runs[j].back() = p1;
+		}
+
+		std::vector<Ubpa::pointf2> knots;
+		std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>> handles;
+		bool isHermite{ false };
+		int type{ 0 };
+
+		std::vector<float> h;	// δһĲ
+		float T{ 1.0f };		// һõܲ
+		std::vector<float> mx, my;	// 
+		std::vector<float> rx, ry, dmx, dmy, cp;	// ֲĲв׷Ϸм
+
+		HermiteCache segments;
+		std::vector<std::vector<Ubpa::pointf2>> runs;	// ÿλĶ㴮˵㣩
+		std::vector<bool> dirty;
+		std::vector<float> drift;	// ϴϸλϽ
+		std::vector<Ubpa::pointf2> vertices;
+		bool verticesDirty{ true };
+
+		bool rebuilt{ false };
+		std::vector<int> changedKnots;
+		std::vector<int> changedSegments;
+
+		std::vector<float> ts, xs, ys, us;
+	};
+}
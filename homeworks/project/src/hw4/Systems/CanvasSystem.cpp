@@ -1,22 +1,27 @@
 #include "CanvasSystem.h"
 
 #include "../Components/CanvasData.h"
+#include "../Components/CurveData.h"
 
 #include <_deps/imgui/imgui.h>
-#include "../ImGuiFileBrowser.h"
-#include "../Parametrization/parametrization.h"
+#include "../../common/ImGuiFileBrowser/ImGuiFileBrowser.h"
 #include "spdlog/spdlog.h"
-#include "../Curve/curve.h"
+#include "../Curve/splinemodel.h"
+#include "../Curve/spatialindex.h"
+#include "../../common/Polyline/lod.h"
 
 #include <fstream>
 
 
 using namespace Ubpa;
 
-constexpr auto MAX_PLOT_NUM_POINTS = 10000;
 constexpr auto SCALE = 20.0f;
+constexpr auto COMB_SCALE = 2000.0f;	// ᳤ =  * COMB_SCALE
+constexpr auto COMB_NUM_TEETH = 400;
+constexpr auto EPSILON = 1E-15;
 
 imgui_addons::ImGuiFileBrowser file_dialog;
+Polyline::LOD lod;	// ύǰĻռ
 
 bool enable_edit = false;
 
@@ -30,22 +35,26 @@ int selectedRight = -1;
 bool validDerivative = false;
 int leftOrRight = -1;	// 0: ʾǰֱ 1:ʾҵֱ
 
+Curve::SplineModel splineModel;		// λϸֽߣδύ϶Ԥֻ
+bool ghostShown = false;			// splineModel ĩβǷиԤ
+bool editCommitted = false;			// ύ˱༭Уֲ
+bool modelStale = false;			// ߱滻ؽģ
+bool handleDragging = false;
+std::pair<Ubpa::pointf2, Ubpa::pointf2> handleBefore;	// ϶ֱǰֵ
+std::vector<ImVec2> polyline;
+ImVec2 polylineOrigin;
+
+bool enable_comb = false;
+std::vector<float> combParams;
+Curve::CurveSamples combSamples;	// Ĳ
+
+Curve::PickIndex pickIndex;		// ݵ㡢ֱ߶ε
+bool rubberBand = false;		// Shift + ϶ѡ
+Ubpa::pointf2 rubberBandStart;
+std::vector<int> boxSelected;	// ѡеݵ
+
+std::vector<ImVec2> curvePolyline;	// õĻ
 
-Eigen::VectorXf parametrization(std::vector<Ubpa::pointf2> points, int parametrizationType) {
-	//parametrization
-	switch (parametrizationType) {
-	case 0:
-		return Parametrization::chordParameterization(points);
-	case 1:
-		return Parametrization::centripetalParameterization(points);
-	case 2:
-		return Parametrization::uniformParameterization(points.size());
-	case 3:
-		return Parametrization::FoleyParameterization(points);
-	default:
-		return Parametrization::chordParameterization(points);
-	}
-}
 
 void drawQuad(ImDrawList* draw_list, Ubpa::pointf2 center, float r, bool isFilled, ImU32 col) {
 	isFilled ? draw_list->AddQuadFilled(ImVec2(center[0] + r, center[1] + r), ImVec2(center[0] + r, center[1] - r), ImVec2(center[0] - r, center[1] - r), ImVec2(center[0] - r, center[1] + r), col) : draw_list->AddQuad(ImVec2(center[0] + r, center[1] + r), ImVec2(center[0] + r, center[1] - r), ImVec2(center[0] - r, center[1] - r), ImVec2(center[0] - r, center[1] + r), col);
@@ -84,6 +93,170 @@ Ubpa::pointf2 Straight_line(Ubpa::pointf2 center, Ubpa::pointf2 D, Ubpa::pointf2
 	return Ubpa::pointf2(x, y);
 }
 
+/*
+/// @brief      һα༭򣨳õģ
+/// @details    ƶݵ޸ֱֻģӰĶΣɾݵ滻 syncModel ֵ仯ؽģ
+/// @param[in]  : forward : true Ϊ
+/// @return
+/// @attention
+*/
+void applyEdit(CanvasData* data, const CanvasEdit& edit, bool forward) {
+	int s = forward ? 1 : 0;
+	switch (edit.type) {
+	case CanvasEdit::MOVE_KNOT:
+		data->points[edit.index] = edit.knot[s];
+		splineModel.MoveKnot(edit.index, edit.knot[s]);
+		editCommitted = true;
+		break;
+	case CanvasEdit::SET_HANDLE:
+		data->derivative[edit.index] = edit.handle[s];
+		splineModel.SetHandle(edit.index, edit.handle[s]);
+		break;
+	case CanvasEdit::ADD_KNOT:
+	case CanvasEdit::REMOVE_KNOT:
+		if ((edit.type == CanvasEdit::ADD_KNOT) == forward) {
+			data->points.push_back(edit.knot[0]);
+			data->derivative.push_back(edit.handle[0]);
+			modelType.push_back(edit.vertexType);
+		}
+		else {
+			data->points.pop_back();
+			data->derivative.pop_back();
+			modelType.pop_back();
+		}
+		break;
+	case CanvasEdit::REPLACE_ALL:
+		data->points = edit.points[s];
+		data->derivative = edit.derivative[s];
+		modelType = edit.vertexTypes[s];
+		validDerivative = edit.hermite[s];
+		modelStale = true;
+		break;
+	}
+}
+
+// òύһα༭µı༭ʹջʧЧ
+void commitEdit(CanvasData* data, CanvasEdit edit) {
+	applyEdit(data, edit, true);
+	data->undoStack.push_back(std::move(edit));
+	data->redoStack.clear();
+}
+
+void undoEdit(CanvasData* data) {
+	if (data->undoStack.empty())
+		return;
+	CanvasEdit edit = std::move(data->undoStack.back());
+	data->undoStack.pop_back();
+	applyEdit(data, edit, false);
+	data->redoStack.push_back(std::move(edit));
+}
+
+void redoEdit(CanvasData* data) {
+	if (data->redoStack.empty())
+		return;
+	CanvasEdit edit = std::move(data->redoStack.back());
+	data->redoStack.pop_back();
+	applyEdit(data, edit, true);
+	data->undoStack.push_back(std::move(edit));
+}
+
+void editKnot(CanvasData* data, int i, Ubpa::pointf2 p) {
+	CanvasEdit edit{ CanvasEdit::MOVE_KNOT };
+	edit.index = i;
+	edit.knot[0] = data->points[i];
+	edit.knot[1] = p;
+	commitEdit(data, std::move(edit));
+}
+
+void editHandle(CanvasData* data, int i, std::pair<Ubpa::pointf2, Ubpa::pointf2> before, std::pair<Ubpa::pointf2, Ubpa::pointf2> after) {
+	CanvasEdit edit{ CanvasEdit::SET_HANDLE };
+	edit.index = i;
+	edit.handle[0] = before;
+	edit.handle[1] = after;
+	commitEdit(data, std::move(edit));
+}
+
+/*
+/// @brief      ÿ֡ʹģ뻭һ
+/// @details    ģʽʽģͲʱؽֻƶ׷ӻɾĩβԤ㣬߳޹
+/// @param[in]  :
+/// @return
+/// @attention
+*/
+void syncModel(CanvasData* data, const Ubpa::pointf2& mouse_pos_in_canvas) {
+	int committed = data->points.size();
+	if (modelStale || splineModel.IsHermite() != validDerivative || splineModel.ParametrizationType() != data->parametrizationType || splineModel.NumKnots() != committed + (ghostShown ? 1 : 0)) {
+		splineModel.Reset(data->points, data->derivative, validDerivative, data->parametrizationType);
+		ghostShown = false;
+		modelStale = false;
+	}
+
+	// ifΪ˱⵱껹ûüƶʱmouse_pos_in_canvasback()һ
+	// ¸غʱ⣬ҳַĸΪ0ֳݵ
+	bool wantGhost = committed && !data->isEnd && mouse_pos_in_canvas != data->points.back();
+	if (wantGhost && !ghostShown) {
+		splineModel.AppendKnot(mouse_pos_in_canvas, std::make_pair(Ubpa::pointf2(0.0f, 0.0f), Ubpa::pointf2(0.0f, 0.0f)));
+		ghostShown = true;
+	}
+	else if (wantGhost && splineModel.Knot(committed) != mouse_pos_in_canvas) {
+		splineModel.MoveKnot(committed, mouse_pos_in_canvas);
+	}
+	else if (!wantGhost && ghostShown) {
+		splineModel.PopKnot();
+		ghostShown = false;
+	}
+}
+
+// ڱ༭ߴΪһʵ壬صӵ״̬
+void stashCurve(Ubpa::UECS::World* w, CanvasData* data) {
+	if (data->points.size()) {
+		auto [e, knots, spline, tess] = w->entityMngr.Create<CurveKnots, CurveSpline, CurveTessellation>();
+		knots->points = std::move(data->points);
+		knots->derivative = std::move(data->derivative);
+		knots->parametrizationType = data->parametrizationType;
+		knots->hermite = validDerivative;
+	}
+	data->points.clear();
+	data->derivative.clear();
+	data->undoStack.clear();
+	data->redoStack.clear();
+	data->isEnd = false;
+	modelType.clear();
+	boxSelected.clear();
+	validDerivative = false;
+	enable_edit = false;
+	selectedCtrlPoint = -1;
+	selectedRight = -1;
+	modelStale = true;
+}
+
+// ʵȡػ༭ǰߴΪʵ壬ȡصʵɾ
+void loadCurve(Ubpa::UECS::World* w, CanvasData* data, Ubpa::UECS::Entity e, CurveKnots&& knots) {
+	stashCurve(w, data);
+	w->entityMngr.Destroy(e);
+	data->points = std::move(knots.points);
+	data->derivative = std::move(knots.derivative);
+	data->parametrizationType = knots.parametrizationType;
+	data->isEnd = true;
+	validDerivative = knots.hermite;
+	modelType.assign(data->points.size(), 0);
+	modelType.front() = 2;
+	modelType.back() = 2;
+	selectedRight = data->points.size() - 1;
+}
+
+// 㵽ߵľƽ
+float distance2ToPolyline(const std::vector<Ubpa::pointf2>& polyline, const Ubpa::pointf2& p) {
+	float best = FLT_MAX;
+	for (int k = 0; k + 1 < polyline.size(); ++k) {
+		Ubpa::vecf2 e = polyline[k + 1] - polyline[k];
+		float len2 = e.norm2();
+		float u = len2 > 0.0f ? std::min(std::max((p - polyline[k]).dot(e) / len2, 0.0f), 1.0f) : 0.0f;
+		best = std::min(best, (p - (polyline[k] + e * u)).norm2());
+	}
+	return best;
+}
+
 void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 	spdlog::set_pattern("[%H:%M:%S] %v");
 	//spdlog::set_pattern("%+"); // back to default format
@@ -112,12 +285,16 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				ImGui::BulletText("Ctrl+O: Import Data");
 				ImGui::BulletText("Ctrl+S: Export Data");
 				ImGui::BulletText("Tab: change the parameterization method.");
+				ImGui::BulletText("Shift + Mouse Left: drag to box-select points (edit mode).");
+				ImGui::BulletText("Ctrl + Mouse Left: pick another curve to edit.");
 				ImGui::Separator();
 
 			}
 
 			ImGui::Checkbox("Enable grid", &data->opt_enable_grid); ImGui::SameLine(200);
-			ImGui::Checkbox("Enable context menu", &data->opt_enable_context_menu);
+			ImGui::Checkbox("Enable context menu", &data->opt_enable_context_menu); ImGui::SameLine(400);
+			ImGui::Checkbox("Curvature comb", &enable_comb);
+			lod.ShowControls();
 
 			ImGui::Separator();
 
@@ -149,6 +326,29 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			const bool is_active = ImGui::IsItemActive();   // Held
 			const ImVec2 origin(canvas_p0.x + data->scrolling[0], canvas_p0.y + data->scrolling[1]); // Lock scrolled origin
 			const pointf2 mouse_pos_in_canvas(io.MousePos.x - origin.x, io.MousePos.y - origin.y);
+			data->viewMin = valf2(canvas_p0.x - origin.x, canvas_p0.y - origin.y);
+			data->viewMax = valf2(canvas_p1.x - origin.x, canvas_p1.y - origin.y);
+
+			// Ctrl + ȡ߽б༭
+			if (is_hovered && io.KeyCtrl && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+				const float pick_radius = r + 3;
+				float best = pick_radius * pick_radius;
+				Ubpa::UECS::Entity picked;
+				CurveKnots pickedKnots;
+				w->RunEntityJob([&](Ubpa::UECS::Entity e, const CurveKnots* knots, const CurveSpline* spline, const CurveTessellation* tess) {
+					if (mouse_pos_in_canvas[0] < spline->lo[0] - pick_radius || mouse_pos_in_canvas[0] > spline->hi[0] + pick_radius
+						|| mouse_pos_in_canvas[1] < spline->lo[1] - pick_radius || mouse_pos_in_canvas[1] > spline->hi[1] + pick_radius)
+						return;
+					float d2 = distance2ToPolyline(tess->vertices, mouse_pos_in_canvas);
+					if (d2 < best) {
+						best = d2;
+						picked = e;
+						pickedKnots = *knots;
+					}
+				}, false);
+				if (pickedKnots.points.size())
+					loadCurve(w, data, picked, std::move(pickedKnots));
+			}
 
 			// add a point
 			if (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) { 
@@ -156,12 +356,15 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				modelType[0] = 2;  // βģʽΪǲ
 				modelType.back() = 2;
 			}	// ˫
-			if (is_hovered && !data->isEnd && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
-				data->points.push_back(mouse_pos_in_canvas);
-				data->_mx.push_back(0.0f);
-				data->_my.push_back(0.0f);
-				data->derivative.push_back(std::make_pair(Ubpa::pointf2(0.0f, 0.0f), Ubpa::pointf2(0.0f, 0.0f)));
-				modelType.push_back(0);
+			if (is_hovered && !data->isEnd && !io.KeyCtrl && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+				// Ԥ괦ֱתΪύĵ㣬ģؽ
+				if (ghostShown && splineModel.Knot(data->points.size()) == mouse_pos_in_canvas)
+					ghostShown = false;
+				CanvasEdit edit{ CanvasEdit::ADD_KNOT };
+				edit.knot[0] = mouse_pos_in_canvas;
+				edit.handle[0] = std::make_pair(Ubpa::pointf2(0.0f, 0.0f), Ubpa::pointf2(0.0f, 0.0f));
+				commitEdit(data, std::move(edit));
+				editCommitted = true;
 				selectedRight++;
 				spdlog::info("Point added at: {}, {}", data->points.back()[0], data->points.back()[1]);
 				spdlog::info(enable_edit);
@@ -175,21 +378,33 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				ImGui::OpenPopup("Export Data");
 				data->exportData = false;
 			}
+			if (io.KeyCtrl && ImGui::IsKeyPressed(90)) { data->undo = true; }	// Ctrl+Z
+			if (io.KeyCtrl && ImGui::IsKeyPressed(89)) { data->redo = true; }	// Ctrl+Y
+			if (data->undo || data->redo) {
+				data->undo ? undoEdit(data) : redoEdit(data);
+				data->undo = data->redo = false;
+				selectedCtrlPoint = -1;
+				boxSelected.clear();
+				selectedRight = std::min(selectedRight, static_cast<int>(data->points.size()) - 1);
+				if (selectedRight < 0)
+					selectedRight = data->points.size() - 1;
+			}
 
 
 			if (file_dialog.showFileDialog("Import Data", imgui_addons::ImGuiFileBrowser::DialogMode::OPEN, ImVec2(700, 310), ".txt,.xy,.*")) {
-				data->points.clear();
-				validDerivative = false;
-				modelType.clear();
+				CanvasEdit edit{ CanvasEdit::REPLACE_ALL };
+				edit.points[0] = data->points;
+				edit.derivative[0] = data->derivative;
+				edit.vertexTypes[0] = modelType;
+				edit.hermite[0] = validDerivative;
 				std::ifstream in(file_dialog.selected_path);
 				float x, y;
 				while (in >> x >> y) {
-					data->points.push_back(ImVec2(x, y));
-					data->_mx.push_back(0.0f);
-					data->_my.push_back(0.0f);
-					data->derivative.push_back(std::make_pair(Ubpa::pointf2(0.0f, 0.0f), Ubpa::pointf2(0.0f, 0.0f)));
-					modelType.push_back(0);
+					edit.points[1].push_back(ImVec2(x, y));
+					edit.derivative[1].push_back(std::make_pair(Ubpa::pointf2(0.0f, 0.0f), Ubpa::pointf2(0.0f, 0.0f)));
+					edit.vertexTypes[1].push_back(0);
 				}
+				commitEdit(data, std::move(edit));
 				selectedRight = data->points.size() - 1;
 				spdlog::info(file_dialog.selected_path);
 			}
@@ -225,25 +440,30 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			if (data->opt_enable_context_menu && ImGui::IsMouseReleased(ImGuiMouseButton_Right) && drag_delta.x == 0.0f && drag_delta.y == 0.0f)
 				ImGui::OpenPopupContextItem("context");
 			if (ImGui::BeginPopup("context")) {
+				if (ImGui::MenuItem("Undo", "Ctrl+Z", false, !data->undoStack.empty())) { data->undo = true; }
+				if (ImGui::MenuItem("Redo", "Ctrl+Y", false, !data->redoStack.empty())) { data->redo = true; }
 				if (ImGui::MenuItem("Remove one", NULL, false, data->points.size() > 0)) {
-					data->points.resize(data->points.size() - 1);
-					data->_mx.resize(data->_mx.size() - 1);
-					data->_my.resize(data->_my.size() - 1);
-					data->derivative.resize(data->derivative.size() - 1);
-					modelType.resize(modelType.size() - 1);
+					CanvasEdit edit{ CanvasEdit::REMOVE_KNOT };
+					edit.knot[0] = data->points.back();
+					edit.handle[0] = data->derivative.back();
+					edit.vertexType = modelType.back();
+					commitEdit(data, std::move(edit));
 					if (selectedRight == data->points.size()) {
 						selectedRight--;
 					}
 				}
 				if (ImGui::MenuItem("Remove all", NULL, false, data->points.size() > 0)) {
-					data->points.clear();
-					data->_mx.clear();
-					data->_my.clear();
-					data->derivative.clear();
-					modelType.clear();
-					validDerivative = false;
+					CanvasEdit edit{ CanvasEdit::REPLACE_ALL };
+					edit.points[0] = data->points;
+					edit.derivative[0] = data->derivative;
+					edit.vertexTypes[0] = modelType;
+					edit.hermite[0] = validDerivative;
+					commitEdit(data, std::move(edit));
 					selectedRight = -1;
 				}
+				if (ImGui::MenuItem("New curve", NULL, false, data->points.size() > 0)) {
+					stashCurve(w, data);
+				}
 				if (ImGui::MenuItem("Add...", NULL, false)) {
 					data->isEnd = false;
 					enable_edit = false;
@@ -252,6 +472,9 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				}
 				if (ImGui::MenuItem("Edit...", NULL, enable_edit, data->isEnd)) {
 					// TODO: ʾֱ
+					// ģʽµĵֻģУ༭ʱһΪֱֵ
+					if (!validDerivative && splineModel.NumKnots() == data->points.size())
+						splineModel.ExportDerivatives(&data->derivative);
 					validDerivative = true;
 					enable_edit = !enable_edit;
 				}
@@ -260,24 +483,28 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					spdlog::info("1111111:{}", selectedRight);
 					
 					// ֱ 
+					std::pair<Ubpa::pointf2, Ubpa::pointf2> d = data->derivative[selectedRight];
 					if (!leftOrRight && selectedRight!=0) {
-						data->derivative[selectedRight].second = data->derivative[selectedRight].first;
+						d.second = d.first;
 					}
 					if (leftOrRight && selectedRight != data->points.size() - 1) {
-						data->derivative[selectedRight].first = data->derivative[selectedRight].second;
+						d.first = d.second;
 					}
+					editHandle(data, selectedRight, data->derivative[selectedRight], d);
 					modelType[selectedRight] = 0;
 				}
 				if (ImGui::MenuItem("Straight line...", NULL, modelType[selectedRight] == 1, enable_edit && selectedRight > 0 && selectedRight!=data->points.size()-1)) {
 					// ֱ߶
 					spdlog::info("222222:{}", selectedRight);
 					// ֱ 
+					std::pair<Ubpa::pointf2, Ubpa::pointf2> d = data->derivative[selectedRight];
 					if (!leftOrRight && selectedRight != 0) {
-						data->derivative[selectedRight].second = Straight_line(data->points[selectedRight], data->derivative[selectedRight].first, data->derivative[selectedRight].second);
+						d.second = Straight_line(data->points[selectedRight], d.first, d.second);
 					}
 					if (leftOrRight && selectedRight != data->points.size() - 1) {
-						data->derivative[selectedRight].first = Straight_line(data->points[selectedRight], data->derivative[selectedRight].second, data->derivative[selectedRight].first);
+						d.first = Straight_line(data->points[selectedRight], d.second, d.first);
 					}
+					editHandle(data, selectedRight, data->derivative[selectedRight], d);
 					modelType[selectedRight] = 1;
 				}
 				if (ImGui::MenuItem("Corner...", NULL, modelType[selectedRight] == 2, enable_edit && selectedRight != -1)) {
@@ -290,6 +517,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 
 			// Draw grid + all lines in the canvas
 			draw_list->PushClipRect(canvas_p0, canvas_p1, true);
+			lod.BeginFrame(canvas_p0, canvas_p1);
 			if (data->opt_enable_grid) {
 				const float GRID_STEP = 64.0f;
 				for (float x = fmodf(data->scrolling[0], GRID_STEP); x < canvas_sz.x; x += GRID_STEP)
@@ -298,38 +526,75 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					draw_list->AddLine(ImVec2(canvas_p0.x, canvas_p0.y + y), ImVec2(canvas_p1.x, canvas_p0.y + y), IM_COL32(200, 200, 200, 40));
 			}
 
+			// ߣΧڻĲ
+			w->RunEntityJob([&](const CurveSpline* spline, const CurveTessellation* tess) {
+				if (tess->vertices.empty() || spline->hi[0] < data->viewMin[0] || spline->lo[0] > data->viewMax[0] || spline->hi[1] < data->viewMin[1] || spline->lo[1] > data->viewMax[1])
+					return;
+				curvePolyline.resize(tess->vertices.size());
+				for (int n = 0; n < tess->vertices.size(); ++n)
+					curvePolyline[n] = ImVec2(tess->vertices[n][0] + origin.x, tess->vertices[n][1] + origin.y);
+				lod.AddPolyline(draw_list, curvePolyline.data(), curvePolyline.size(), IM_COL32(0, 160, 0, 255), false, 1.0f);
+			}, false);
+
 			// ݵ
 			if (!enable_edit) {
 				for (int n = 0; n < data->points.size(); ++n) {
 					draw_list->AddCircleFilled(ImVec2(origin.x + data->points[n][0], origin.y + data->points[n][1]), 4, IM_COL32(255, 255, 255, 255));
 				}
 			} else {
-				// жǷѡĳ
 				for (int i = 0; i < data->points.size(); ++i) {
 					drawQuad(draw_list, ImVec2(origin.x + data->points[i][0], origin.y + data->points[i][1]), r-1, selectedRight == i, IM_COL32(255, 255, 255, 255));
-					if (selectedCtrlPoint < 0 && (mouse_pos_in_canvas - data->points[i]).norm2() < 20) {
-						ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
-						if (ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
-							selectedCtrlPoint = i;
-							selectedRight = i;
-						}
-						if (ImGui::IsMouseClicked(ImGuiMouseButton_Right)) { selectedRight = i; }
+				}
+				for (int i : boxSelected) {
+					if (i < data->points.size())
+						drawQuad(draw_list, ImVec2(origin.x + data->points[i][0], origin.y + data->points[i][1]), r-1, true, IM_COL32(0, 160, 255, 255));
+				}
+				// жǷѡĳ
+				int hovered = selectedCtrlPoint < 0 && !rubberBand ? pickIndex.PickKnot(mouse_pos_in_canvas, sqrtf(20)) : -1;
+				if (hovered >= 0 && hovered < data->points.size()) {
+					ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
+					if (ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+						selectedCtrlPoint = hovered;
+						selectedRight = hovered;
 					}
+					if (ImGui::IsMouseClicked(ImGuiMouseButton_Right)) { selectedRight = hovered; }
+				}
+				else if (selectedCtrlPoint < 0 && is_hovered) {
+					// 꿿ʱϵ
+					Curve::CurvePick pick = pickIndex.NearestOnCurve(splineModel, mouse_pos_in_canvas, r + 3);
+					if (pick.segment >= 0)
+						draw_list->AddCircle(ImVec2(origin.x + pick.point[0], origin.y + pick.point[1]), r, IM_COL32(0, 160, 255, 255));
+				}
+
+				// ѡ
+				if (is_hovered && hovered < 0 && io.KeyShift && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+					rubberBand = true;
+					rubberBandStart = mouse_pos_in_canvas;
+				}
+				if (rubberBand) {
+					Curve::Box box{ Ubpa::pointf2(std::min(rubberBandStart[0], mouse_pos_in_canvas[0]), std::min(rubberBandStart[1], mouse_pos_in_canvas[1])),
+						Ubpa::pointf2(std::max(rubberBandStart[0], mouse_pos_in_canvas[0]), std::max(rubberBandStart[1], mouse_pos_in_canvas[1])) };
+					pickIndex.QueryKnots(box, &boxSelected);
+					draw_list->AddRect(ImVec2(origin.x + box.lo[0], origin.y + box.lo[1]), ImVec2(origin.x + box.hi[0], origin.y + box.hi[1]), IM_COL32(0, 160, 255, 255));
+					if (ImGui::IsMouseReleased(ImGuiMouseButton_Left))
+						rubberBand = false;
 				}
 			}
 
 			// ܶǷֱָ
-			if (enable_edit && selectedRight > -1 && selectedCtrlPoint == -1) {
-				if ((mouse_pos_in_canvas - pointf2(-data->derivative[selectedRight].first[0] / SCALE + data->points[selectedRight][0], -data->derivative[selectedRight].first[1] / SCALE + data->points[selectedRight][1])).norm2() < 60) {
-					ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
-					leftOrRight = 0;
-				}
-				if ((mouse_pos_in_canvas - pointf2(data->derivative[selectedRight].second[0] / SCALE + data->points[selectedRight][0], data->derivative[selectedRight].second[1] / SCALE + data->points[selectedRight][1])).norm2() < 60) {
+			if (enable_edit && selectedRight > -1 && selectedCtrlPoint == -1 && !rubberBand) {
+				int handle = pickIndex.PickHandle(mouse_pos_in_canvas, sqrtf(60), selectedRight);
+				if (handle >= 0) {
 					ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
-					leftOrRight = 1;
+					leftOrRight = handle % 2;
 				}
 				if (ImGui::IsMouseDragging(ImGuiMouseButton_Left) && !ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
 					spdlog::info("----> handle drag");
+					// ϶ֱ޸ֱɿʱΪһα༭ύ
+					if (!handleDragging) {
+						handleDragging = true;
+						handleBefore = data->derivative[selectedRight];
+					}
 					if (leftOrRight == 0) {
 						data->derivative[selectedRight].first = Ubpa::pointf2(SCALE * (data->points[selectedRight][0] - mouse_pos_in_canvas[0]), SCALE * (data->points[selectedRight][1] - mouse_pos_in_canvas[1]));
 						if (modelType[selectedRight] == 0) {
@@ -353,22 +618,22 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 						}
 						validDerivative = true;
 					}
+					splineModel.SetHandle(selectedRight, data->derivative[selectedRight]);
 				}
 			}
+			if (handleDragging && ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
+				handleDragging = false;
+				if (selectedRight < data->points.size() && data->derivative[selectedRight] != handleBefore)
+					editHandle(data, selectedRight, handleBefore, data->derivative[selectedRight]);
+			}
 
 			if (selectedCtrlPoint > -1 ) {
 				ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
 				// ϶ʵĵ¼
 				if (ImGui::IsMouseDragging(ImGuiMouseButton_Left) && !ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
-					// 
-					std::vector<Ubpa::pointf2> tempcpoints = data->points;
-					tempcpoints[selectedCtrlPoint] = mouse_pos_in_canvas;
-					Eigen::VectorXf temppara = parametrization(tempcpoints, data->parametrizationType);
-					for (int segment_idx = 0; segment_idx < tempcpoints.size() - 1; ++segment_idx) {
-						for (float t = temppara[segment_idx]; t <= temppara[segment_idx + 1]; t += 0.001) {
-							draw_list->AddCircleFilled(ImVec2(Curve::interpolationBSpline(tempcpoints, t, temppara, segment_idx, &(data->_mx), &(data->_my), &(data->derivative), true) + origin), 1, IM_COL32(255, 255, 255, 255));
-						}
-					}
+					// ϶еλֻģϣֻб϶㸽ĶҪϸ
+					if (splineModel.Knot(selectedCtrlPoint) != mouse_pos_in_canvas)
+						splineModel.MoveKnot(selectedCtrlPoint, mouse_pos_in_canvas);
 					drawQuad(draw_list, ImVec2(origin.x + mouse_pos_in_canvas[0], origin.y + mouse_pos_in_canvas[1]), r-1, true, IM_COL32(255, 255, 255, 255));
 					// һ׵Ľֱ
 					enable_handel = false;
@@ -376,49 +641,55 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				}
 				spdlog::info("aaa:{}", selectedCtrlPoint);
 				if (ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
-					data->points[selectedCtrlPoint] = mouse_pos_in_canvas;
+					if (data->points[selectedCtrlPoint] != mouse_pos_in_canvas)
+						editKnot(data, selectedCtrlPoint, mouse_pos_in_canvas);
 					selectedCtrlPoint = -1;
 				}
 
 			}
 
 
+			// 
+			syncModel(data, mouse_pos_in_canvas);
+			if (editCommitted) {
+				splineModel.Refresh();
+				editCommitted = false;
+			}
+			// ֻܱ༭ӰĶβŻϸ֣θûĶ
+			int retessellated = splineModel.Tessellate();
+			pickIndex.Update(splineModel, SCALE);
+
 			if (data->points.size()) {
-				// 
-				ImVec2 BSP[MAX_PLOT_NUM_POINTS];
-				
-				std::vector<float> _mx = data->_mx;
-				std::vector<float> _my = data->_my;
-				std::vector< Ubpa::pointf2> cpoints = data->points;
-				std::vector<std::pair<Ubpa::pointf2, Ubpa::pointf2>> _derivative = data->derivative;
-
-				// ifΪ˱⵱껹ûüƶʱmouse_pos_in_canvasback()һ
-				// ¸غʱ⣬ҳַĸΪ0ֳݵ
-				bool added = false;
-				if (!data->isEnd && mouse_pos_in_canvas != cpoints.back()) {
-					cpoints.push_back(mouse_pos_in_canvas);
-					_mx.push_back(0.0f);
-					_my.push_back(0.0f);
-					_derivative.push_back(std::make_pair(Ubpa::pointf2(0.0f, 0.0f), Ubpa::pointf2(0.0f, 0.0f)));
-					added = true;
+				if (retessellated || origin.x != polylineOrigin.x || origin.y != polylineOrigin.y || splineModel.NumSegments() == 0) {
+					const auto& vertices = splineModel.Vertices();
+					polyline.resize(vertices.size());
+					for (int n = 0; n < vertices.size(); ++n)
+						polyline[n] = ImVec2(vertices[n][0] + origin.x, vertices[n][1] + origin.y);
+					polylineOrigin = origin;
 				}
-				Eigen::VectorXf para = parametrization(cpoints, data->parametrizationType);
-				int p_index = 0;
-				for (int segment_idx = 0; segment_idx < cpoints.size() - 1; ++segment_idx) {
-					for (float t = para[segment_idx]; t <= para[segment_idx + 1] && p_index < MAX_PLOT_NUM_POINTS; t += 0.001) {
-						Ubpa::pointf2 bs_point = Curve::interpolationBSpline(cpoints, t, para, segment_idx, &_mx, &_my, &_derivative, validDerivative);
-						BSP[p_index++] = ImVec2(bs_point + origin);
+				lod.AddPolyline(draw_list, polyline.data(), polyline.size(), IM_COL32(0, 255, 0, 255), false, 1.0f);
+				if (enable_comb && splineModel.NumSegments()) {
+					// ط򣬳ʳ
+					combParams.resize(COMB_NUM_TEETH + 1);
+					for (int n = 0; n <= COMB_NUM_TEETH; ++n)
+						combParams[n] = static_cast<float>(n) / COMB_NUM_TEETH;
+					splineModel.Evaluate(combParams.data(), combParams.size(), &combSamples);
+					ImVec2 prev;
+					bool hasPrev = false;
+					for (int n = 0; n < combSamples.Size(); ++n) {
+						float speed = sqrtf(combSamples.dx[n] * combSamples.dx[n] + combSamples.dy[n] * combSamples.dy[n]);
+						if (speed == 0.0f)
+							continue;
+						float len = -combSamples.curvature[n] * COMB_SCALE / speed;
+						ImVec2 base(combSamples.x[n] + origin.x, combSamples.y[n] + origin.y);
+						ImVec2 tip(base.x - combSamples.dy[n] * len, base.y + combSamples.dx[n] * len);
+						draw_list->AddLine(base, tip, IM_COL32(255, 128, 0, 160));
+						if (hasPrev)
+							draw_list->AddLine(prev, tip, IM_COL32(255, 128, 0, 255));
+						prev = tip;
+						hasPrev = true;
 					}
 				}
-				if (added) {
-					_mx.pop_back();
-					_my.pop_back();
-					_derivative.pop_back();
-				}
-				data->_mx = _mx;
-				data->_my = _my;
-				data->derivative = _derivative;
-				draw_list->AddPolyline(BSP, p_index, IM_COL32(0, 255, 0, 255), false, 1.0f);
 				if (enable_edit && enable_handel) {
 					drawHandel(draw_list, data->points[selectedRight], data->derivative[selectedRight], origin, r+3, IM_COL32(255, 255, 0, 255), IM_COL32(255, 255, 255, 255), selectedRight == 0, selectedRight == data->points.size() - 1);
 				}
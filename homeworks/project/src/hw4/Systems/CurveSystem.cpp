@@ -0,0 +1,34 @@
+#include "CurveSystem.h"
+
+#include "../Components/CanvasData.h"
+#include "../Components/CurveData.h"
+
+using namespace Ubpa;
+
+void CurveSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
+	schedule.RegisterCommand([](Ubpa::UECS::World* w) {
+		auto data = w->entityMngr.GetSingleton<CanvasData>();
+		if (!data)
+			return;
+
+		const valf2 viewMin = data->viewMin;
+		const valf2 viewMax = data->viewMax;
+
+		// ֻδϸֵߣΧڻȲϸ֣ٴ
+		w->RunEntityJob([=](const CurveKnots* knots, CurveSpline* spline, CurveTessellation* tess) {
+			if (tess->version == knots->version)
+				return;
+			if (spline->version != knots->version) {
+				spline->model.Sync(knots->points, knots->derivative, knots->hermite, knots->parametrizationType);
+				spline->model.Bounds(spline->lo, spline->hi);
+				spline->version = knots->version;
+			}
+			if (spline->hi[0] < viewMin[0] || spline->lo[0] > viewMax[0] || spline->hi[1] < viewMin[1] || spline->lo[1] > viewMax[1])
+				return;
+			spline->model.Tessellate();
+			spline->model.ClearChanges();
+			tess->vertices = spline->model.Vertices();
+			tess->version = knots->version;
+		});
+	});
+}
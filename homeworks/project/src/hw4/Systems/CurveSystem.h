@@ -0,0 +1,7 @@
+#pragma once
+
+#include <UECS/World.h>
+
+struct CurveSystem {
+	static void OnUpdate(Ubpa::UECS::Schedule& schedule);
+};
\ No newline at end of file
@@ -5,7 +5,9 @@
 #include <UECS/World.h>
 
 #include "Components/CanvasData.h"
+#include "Components/CurveData.h"
 #include "Systems/CanvasSystem.h"
+#include "Systems/CurveSystem.h"
 
 #ifndef NDEBUG
 #include <dxgidebug.h>
@@ -26,7 +28,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE prevInstance, PSTR cmdLine, in
 
         auto game = app.GetGameWorld();
         game->systemMngr.RegisterAndActivate<CanvasSystem>();
+        game->systemMngr.RegisterAndActivate<CurveSystem>();
         game->entityMngr.cmptTraits.Register<CanvasData>();
+        game->entityMngr.cmptTraits.Register<CurveKnots, CurveSpline, CurveTessellation>();
         game->entityMngr.Create<CanvasData>();
 
 		rst = app.Run();
@@ -6,6 +6,8 @@ struct CanvasData {
 	std::vector<Ubpa::pointf2> points;
 
 	Ubpa::valf2 scrolling{ 0.f,0.f };
+	Ubpa::valf2 viewMin{ 0.f,0.f };	// ɼ򣨻꣩޳
+	Ubpa::valf2 viewMax{ 0.f,0.f };
 	bool opt_enable_grid{ false };
 	bool opt_enable_context_menu{ true };
 
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <UGM/UGM.h>
+
+// ϳڱ༭⣬ÿһʵ壬
+
+// Ƶϸֲʵ彨ú޸ģȡػ༭ʱʵ屻ɾʱ½ʵ壬
+//  version Ϊ 1CurveTessellation  version Ϊ 0 ʾδ
+struct CurveKnots {
+	std::vector<Ubpa::pointf2> points;
+
+	bool chaikin{ true };
+	bool cubic{ false };
+	bool quad{ false };
+	bool sixPoint{ false };
+	bool ternary{ false };
+	bool closed{ false };
+	int step_num = 3;
+	int alpha = 12;	// ĵϸֵĲΪ 1/alpha
+	unsigned version{ 1 };
+};
+
+// ϸָʽϸ step_num ĽΧУպβӣversion  CurveKnots ͬʾЧ
+struct CurveTessellation {
+	std::vector<std::vector<Ubpa::pointf2>> polylines;
+	Ubpa::pointf2 lo{ 0.f,0.f };
+	Ubpa::pointf2 hi{ 0.f,0.f };
+	unsigned version{ 0 };
+};
+
+#include "details/CurveData_AutoRefl.inl"
@@ -0,0 +1,67 @@
+// This file is generated by Ubpa::USRefl::AutoRefl
+
+#pragma once
+
+#include <USRefl/USRefl.h>
+
+template<>
+struct Ubpa::USRefl::TypeInfo<CurveKnots> :
+    TypeInfoBase<CurveKnots>
+{
+#ifdef UBPA_USREFL_NOT_USE_NAMEOF
+    static constexpr char name[11] = "CurveKnots";
+#endif
+    static constexpr AttrList attrs = {};
+    static constexpr FieldList fields = {
+        Field {TSTR("points"), &Type::points},
+        Field {TSTR("chaikin"), &Type::chaikin, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { true }; }},
+        }},
+        Field {TSTR("cubic"), &Type::cubic, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("quad"), &Type::quad, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("sixPoint"), &Type::sixPoint, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("ternary"), &Type::ternary, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("closed"), &Type::closed, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return { false }; }},
+        }},
+        Field {TSTR("step_num"), &Type::step_num, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 3; }},
+        }},
+        Field {TSTR("alpha"), &Type::alpha, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 12; }},
+        }},
+        Field {TSTR("version"), &Type::version, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->unsigned{ return { 1 }; }},
+        }},
+    };
+};
+
+template<>
+struct Ubpa::USRefl::TypeInfo<CurveTessellation> :
+    TypeInfoBase<CurveTessellation>
+{
+#ifdef UBPA_USREFL_NOT_USE_NAMEOF
+    static constexpr char name[18] = "CurveTessellation";
+#endif
+    static constexpr AttrList attrs = {};
+    static constexpr FieldList fields = {
+        Field {TSTR("polylines"), &Type::polylines},
+        Field {TSTR("lo"), &Type::lo, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->Ubpa::pointf2{ return { 0.f,0.f }; }},
+        }},
+        Field {TSTR("hi"), &Type::hi, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->Ubpa::pointf2{ return { 0.f,0.f }; }},
+        }},
+        Field {TSTR("version"), &Type::version, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->unsigned{ return { 0 }; }},
+        }},
+    };
+};
@@ -0,0 +1,219 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "SubdivisionStencil.h"
+
+#include <algorithm>
+#include <vector>
+
+/**********************************************************************************
+/// @file       SubdivisionEngine.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ˫ϸ
+/// @details    ÿ鸴õĻ֮ϸ֣
+///             ڲѭ±ȡģβպߵƻص
+///              Subdivision.h еĶӦһ
+**********************************************************************************/
+
+namespace Subdivision {
+	enum class Scheme { Chaikin, Cubic, Quad };
+
+	// n ϸһĵ
+	inline int outputSize(Scheme scheme, int n, bool close) {
+		if (close)
+			return 2 * n;
+		switch (scheme) {
+		case Scheme::Chaikin: return 2 * n - 2;
+		case Scheme::Cubic: return 2 * n - 3;
+		default: return 2 * n - 2;
+		}
+	}
+
+	// ֲõĵģ壬˼˳ϸ֤߽ͬλͬ
+	inline void chaikinPoint(const Ubpa::pointf2& a, const Ubpa::pointf2& b, Ubpa::pointf2& o) {
+		o[0] = 0.25f * a[0] + 0.75f * b[0];
+		o[1] = 0.25f * a[1] + 0.75f * b[1];
+	}
+
+	inline void cubicVertex(const Ubpa::pointf2& a, const Ubpa::pointf2& b, const Ubpa::pointf2& c, Ubpa::pointf2& o) {
+		o[0] = 0.125f * a[0] + 0.75f * b[0] + 0.125f * c[0];
+		o[1] = 0.125f * a[1] + 0.75f * b[1] + 0.125f * c[1];
+	}
+
+	inline void cubicEdge(const Ubpa::pointf2& a, const Ubpa::pointf2& b, Ubpa::pointf2& o) {
+		o[0] = 0.5f * a[0] + 0.5f * b[0];
+		o[1] = 0.5f * a[1] + 0.5f * b[1];
+	}
+
+	// a = (1 + alpha) / 2b = alpha / 2
+	inline void quadEdge(float a, float b, const Ubpa::pointf2& p0, const Ubpa::pointf2& p1, const Ubpa::pointf2& p2, const Ubpa::pointf2& p3, Ubpa::pointf2& o) {
+		o[0] = a * (p1[0] + p2[0]) - b * (p0[0] + p3[0]);
+		o[1] = a * (p1[1] + p2[1]) - b * (p0[1] + p3[1]);
+	}
+
+	/*
+	/// @brief      Chaikin ϸһ
+	/// @details    պϣout[2i] = 1/4 P(i-1) + 3/4 P(i)out[2i+1] = 3/4 P(i) + 1/4 P(i+1)
+	///             պʱȥ׵ĩҲ
+	/// @param[in]  : p : n     out : outputSize 
+	/// @return
+	/// @attention  n >= 3
+	*/
+	inline void chaikinStep(const Ubpa::pointf2* p, int n, bool close, Ubpa::pointf2* out) {
+		stencilStep<ChaikinStencil>(p, n, close, out);
+	}
+
+	/*
+	/// @brief       B ϸһ
+	/// @details     (P(i-1) + 6 P(i) + P(i+1)) / 8ߵ (P(i) + P(i+1)) / 2
+	///             պʱ׵ֻߵ㣬ĩ㲻
+	/// @param[in]  :
+	/// @return
+	/// @attention  n >= 3
+	*/
+	inline void cubicStep(const Ubpa::pointf2* p, int n, bool close, Ubpa::pointf2* out) {
+		stencilStep<CubicStencil>(p, n, close, out);
+	}
+
+	/*
+	/// @brief      ĵֵϸһ
+	/// @details    ԭ㣬ߵ (1 + alpha)(P(i) + P(i+1)) / 2 - alpha (P(i-1) + P(i+2)) / 2
+	///              quad_subdivision һ£պʱβߵҲƻȡ
+	/// @param[in]  :
+	/// @return
+	/// @attention  n >= 3
+	*/
+	inline void quadStep(const Ubpa::pointf2* p, int n, bool close, float alpha, Ubpa::pointf2* out) {
+		const float a = 0.5f * (1.0f + alpha), b = 0.5f * alpha;
+		auto edge = [=](const Ubpa::pointf2& p0, const Ubpa::pointf2& p1, const Ubpa::pointf2& p2, const Ubpa::pointf2& p3, Ubpa::pointf2& o) {
+			quadEdge(a, b, p0, p1, p2, p3, o);
+		};
+		for (int i = 1; i < n - 2; ++i) {
+			out[2 * i] = p[i];
+			edge(p[i - 1], p[i], p[i + 1], p[i + 2], out[2 * i + 1]);
+		}
+		out[0] = p[0];
+		edge(p[n - 1], p[0], p[1], p[2], out[1]);
+		out[2 * n - 4] = p[n - 2];
+		edge(p[n - 3], p[n - 2], p[n - 1], p[0], out[2 * n - 3]);
+		if (close) {
+			out[2 * n - 2] = p[n - 1];
+			edge(p[n - 2], p[n - 1], p[0], p[1], out[2 * n - 1]);
+		}
+	}
+
+	inline void subdivisionStep(Scheme scheme, const Ubpa::pointf2* p, int n, bool close, float alpha, Ubpa::pointf2* out) {
+		switch (scheme) {
+		case Scheme::Chaikin: chaikinStep(p, n, close, out); break;
+		case Scheme::Cubic: cubicStep(p, n, close, out); break;
+		default: quadStep(p, n, close, alpha, out); break;
+		}
+	}
+
+	/*
+	/// @brief      ֻϸһĵ j 
+	/// @details     subdivisionStep ĵ j λͬ±갴ƻأھֲ
+	/// @param[in]  :
+	/// @return
+	/// @attention  0 <= j < outputSize(scheme, n, close)
+	*/
+	inline void subdivisionPoint(Scheme scheme, const Ubpa::pointf2* p, int n, bool close, float alpha, int j, Ubpa::pointf2& o) {
+		auto at = [=](int i) -> const Ubpa::pointf2& { return p[(i + n) % n]; };
+		switch (scheme) {
+		case Scheme::Chaikin: {
+			// պʱ j Ӧպʱĵ j+1 
+			int jj = close ? j : j + 1, i = jj / 2;
+			if (jj % 2 == 0)
+				chaikinPoint(at(i - 1), at(i), o);
+			else
+				chaikinPoint(at(i + 1), at(i), o);
+			break;
+		}
+		case Scheme::Cubic: {
+			int jj = close ? j : j + 1, i = jj / 2;
+			if (jj % 2 == 0)
+				cubicVertex(at(i - 1), at(i), at(i + 1), o);
+			else
+				cubicEdge(at(i), at(i + 1), o);
+			break;
+		}
+		default: {
+			int i = j / 2;
+			if (j % 2 == 0)
+				o = p[i];
+			else
+				quadEdge(0.5f * (1.0f + alpha), 0.5f * alpha, at(i - 1), at(i), at(i + 1), at(i + 2), o);
+			break;
+		}
+		}
+	}
+
+	/*
+	/// @brief      ϸһ [begin, end) ӦĲ
+	/// @details    Chaikin ϸģܴĵϸ i Ӧ 2i  2i+1
+	///             ڲֱ㣬βҪƻصĵ㽻 subdivisionPoint
+	/// @param[in]  :
+	/// @return
+	/// @attention   subdivisionStep ĶӦλͬ
+	*/
+	inline void subdivisionStepRange(Scheme scheme, const Ubpa::pointf2* p, int n, bool close, float alpha, Ubpa::pointf2* out, int begin, int end) {
+		switch (scheme) {
+		case Scheme::Chaikin: stencilStepRange<ChaikinStencil>(p, n, close, out, begin, end); break;
+		case Scheme::Cubic: stencilStepRange<CubicStencil>(p, n, close, out, begin, end); break;
+		default: {
+			const float a = 0.5f * (1.0f + alpha), b = 0.5f * alpha;
+			const int m = outputSize(scheme, n, close);
+			const int i0 = std::min(std::max(begin, 1), end), i1 = std::max(std::min(end, n - 2), i0);
+			auto boundary = [&](int i) {
+				for (int j = 2 * i; j < 2 * i + 2 && j < m; ++j)
+					subdivisionPoint(scheme, p, n, close, alpha, j, out[j]);
+			};
+			for (int i = begin; i < i0; ++i)
+				boundary(i);
+			for (int i = i0; i < i1; ++i) {
+				out[2 * i] = p[i];
+				quadEdge(a, b, p[i - 1], p[i], p[i + 1], p[i + 2], out[2 * i + 1]);
+			}
+			for (int i = i1; i < end; ++i)
+				boundary(i);
+			break;
+		}
+		}
+	}
+
+	// ֿ鲢ϸһ subdivisionStep λͬ
+	inline void subdivisionStepParallel(Scheme scheme, const Ubpa::pointf2* p, int n, bool close, float alpha, Ubpa::pointf2* out, int numThreads) {
+		if (numThreads <= 1) {
+			subdivisionStep(scheme, p, n, close, alpha, out);
+			return;
+		}
+		parallelChunks(n, numThreads, [=](int begin, int end) { subdivisionStepRange(scheme, p, n, close, alpha, out, begin, end); });
+	}
+
+	class Engine {
+	public:
+		/*
+		/// @brief       points ϸ steps 
+		/// @details    黺彻Ϊֻڱʱ·
+		/// @param[in]  : alpha : ĵϸֵĲ    numThreads :  1 ʱÿֿ鲢
+		/// @return     ϸֽ´ε Run ֮ǰЧ
+		/// @attention   3 ʱϸ
+		*/
+		const std::vector<Ubpa::pointf2>& Run(Scheme scheme, const std::vector<Ubpa::pointf2>& points, int steps, bool close, float alpha = 0.075f, int numThreads = 1) {
+			buffers[0].assign(points.begin(), points.end());
+			int cur = 0;
+			for (int st = 0; st < steps && buffers[cur].size() >= 3; ++st) {
+				const std::vector<Ubpa::pointf2>& src = buffers[cur];
+				std::vector<Ubpa::pointf2>& dst = buffers[1 - cur];
+				int n = static_cast<int>(src.size());
+				dst.resize(outputSize(scheme, n, close));
+				subdivisionStepParallel(scheme, src.data(), n, close, alpha, dst.data(), numThreads);
+				cur = 1 - cur;
+			}
+			return buffers[cur];
+		}
+
+	private:
+		std::vector<Ubpa::pointf2> buffers[2];
+	};
+}
@@ -0,0 +1,219 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "SubdivisionEngine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**********************************************************************************
+/// @file       SubdivisionLimit.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ƽϸֱֵֵ
+/// @details    Chaikin ϸȶ B ϸ B 
+///             Ϊڵ㣬Ƶ P(i) Ǽʽblossomڵϵֵ
+///              k ĵ뼫ϵĵ㶼ǶͬһʽֵҪ
+**********************************************************************************/
+
+namespace Subdivision {
+	// ߵĴĵֵϸֲ B  0
+	inline int limitDegree(Scheme scheme) {
+		switch (scheme) {
+		case Scheme::Chaikin: return 2;
+		case Scheme::Cubic: return 3;
+		default: return 0;
+		}
+	}
+
+	// õ㣬 Subdivision.h еȫ
+	inline float distance(const Ubpa::pointf2& a, const Ubpa::pointf2& b) {
+		return sqrtf((b[0] - a[0]) * (b[0] - a[0]) + (b[1] - a[1]) * (b[1] - a[1]));
+	}
+
+	/*
+	/// @brief       [l, l+1] ϵ d ζʽļʽ b(u[0], ..., u[d-1])
+	/// @details    c Ϊöε d+1 Ƶ㣬c[j] Ӧڵ {l-d+1+j, ..., l+j}u Ϊ l ľֲ
+	///             de Boor 㷨 r ɽڵ j-d  j-r+1 ֮ u[r-1] ֵȥ
+	/// @param[in]  :
+	/// @return
+	/// @attention  d <= 3
+	*/
+	inline Ubpa::pointf2 blossom(const Ubpa::pointf2* c, int d, const float* u) {
+		float x[4], y[4];
+		for (int j = 0; j <= d; ++j) {
+			x[j] = c[j][0];
+			y[j] = c[j][1];
+		}
+		for (int r = 1; r <= d; ++r) {
+			for (int j = d; j >= r; --j) {
+				float a = (u[r - 1] - (j - d)) / (d - r + 1);
+				x[j] = (1.0f - a) * x[j - 1] + a * x[j];
+				y[j] = (1.0f - a) * y[j - 1] + a * y[j];
+			}
+		}
+		return Ubpa::pointf2(x[d], y[d]);
+	}
+
+	/*
+	/// @brief       [l, l+1] ϼߵݻϵ
+	/// @details    C(u) = a[0] + a[1] u + a[2] u^2 + a[3] u^3u Ϊֲɾ B Ļõ
+	/// @param[in]  : c : öε d+1 Ƶ
+	/// @return
+	/// @attention  d Ϊ 2 ʱ a[3] = 0
+	*/
+	inline void pieceCoefficients(const Ubpa::pointf2* c, int d, float ax[4], float ay[4]) {
+		for (int i = 0; i < 2; ++i) {
+			float* a = i == 0 ? ax : ay;
+			if (d == 2) {
+				a[0] = 0.5f * (c[0][i] + c[1][i]);
+				a[1] = c[1][i] - c[0][i];
+				a[2] = 0.5f * (c[0][i] - 2.0f * c[1][i] + c[2][i]);
+				a[3] = 0.0f;
+			}
+			else {
+				a[0] = (c[0][i] + 4.0f * c[1][i] + c[2][i]) / 6.0f;
+				a[1] = 0.5f * (c[2][i] - c[0][i]);
+				a[2] = 0.5f * (c[0][i] - 2.0f * c[1][i] + c[2][i]);
+				a[3] = (-c[0][i] + 3.0f * c[1][i] - 3.0f * c[2][i] + c[3][i]) / 6.0f;
+			}
+		}
+	}
+
+	class LimitEvaluator {
+	public:
+		/*
+		/// @brief      ÿƶ
+		/// @details
+		/// @param[in]  : scheme : Chaikin  Cubic
+		/// @return     øʽû B ޻ʱ false
+		/// @attention  points ʹڼ뱣Ч
+		*/
+		bool Reset(Scheme scheme, const std::vector<Ubpa::pointf2>& points, bool close) {
+			d = limitDegree(scheme);
+			p = &points;
+			closed = close;
+			n = static_cast<int>(points.size());
+			// P(i) = b(i+o, ..., i+o+d-1)
+			o = -(d - 1) / 2;
+			return d > 0 && n > d;
+		}
+
+		// 򣬱պʱΪ [0, n)պʱֻȡƵȫĶ
+		float Begin() const { return closed ? 0.0f : static_cast<float>(firstPiece()); }
+		float End() const { return closed ? static_cast<float>(n) : static_cast<float>(lastPiece() + 1); }
+
+		// ϸ k ĵ Engine::Run һ
+		int LevelSize(int k) const {
+			if (closed)
+				return n << k;
+			return ((n - d) << k) + d;
+		}
+
+		/*
+		/// @brief      ϸ k ĵ j 
+		/// @details    Q(m) = b((m+o)h, ..., (m+o+d-1)h)h = 2^-kպʱ j Ӧ m = j + 2^k - 1
+		/// @param[in]  :
+		/// @return      Engine::Run ĵ j һ
+		/// @attention  0 <= j < LevelSize(k)
+		*/
+		Ubpa::pointf2 LevelPoint(int k, int j) const {
+			const int scale = 1 << k;
+			const int m = closed ? j : j + scale - 1;
+			// ڶڹڵ㴦ʽͬʱغȡ m h ڶμ
+			int l = m / scale;
+			if (!closed)
+				l = std::min(std::max(l, firstPiece()), lastPiece());
+			float u[3];
+			for (int r = 0; r < d; ++r)
+				u[r] = static_cast<float>(m + o + r - l * scale) / scale;
+			Ubpa::pointf2 c[4];
+			gather(l, c);
+			return blossom(c, d, u);
+		}
+
+		/*
+		/// @brief      ڲ t λ
+		/// @details    λ b(t, ..., t)ɼʽÿ䣬C'(t) = d (b(t, ..., t, t+1) - b(t, ..., t))
+		/// @param[in]  : t :  [Begin(), End()] 
+		/// @return
+		/// @attention  tangent ΪԲ t ĵ
+		*/
+		Ubpa::pointf2 LimitPoint(float t, Ubpa::vecf2* tangent = nullptr) const {
+			int l = static_cast<int>(floorf(t));
+			if (closed)
+				l = std::min(std::max(l, 0), n - 1);
+			else
+				l = std::min(std::max(l, firstPiece()), lastPiece());
+			Ubpa::pointf2 c[4];
+			gather(l, c);
+			float u[3] = { t - l, t - l, t - l };
+			Ubpa::pointf2 pos = blossom(c, d, u);
+			if (tangent) {
+				u[d - 1] += 1.0f;
+				Ubpa::pointf2 next = blossom(c, d, u);
+				*tangent = Ubpa::vecf2(d * (next[0] - pos[0]), d * (next[1] - pos[1]));
+			}
+			return pos;
+		}
+
+		/*
+		/// @brief      ĻܶȲ
+		/// @details    ÿεĲȡöοƵ߳ / spacingϸ֣
+		///             ڻݻϵ Horner ֵÿֻ輸γ˼
+		/// @param[in]  : spacing : ڲĴ¼ࣨأ
+		/// @return
+		/// @attention  պʱյ㣬պʱβظ
+		*/
+		void Sample(float spacing, std::vector<Ubpa::pointf2>* out) const {
+			out->clear();
+			const int l0 = closed ? 0 : firstPiece();
+			const int l1 = closed ? n - 1 : lastPiece();
+			Ubpa::pointf2 c[4];
+			for (int l = l0; l <= l1; ++l) {
+				gather(l, c);
+				float len = 0.0f;
+				for (int j = 0; j < d; ++j)
+					len += distance(c[j], c[j + 1]);
+				const int num = std::max(1, static_cast<int>(ceilf(len / (d * spacing))));
+				float ax[4], ay[4];
+				pieceCoefficients(c, d, ax, ay);
+				const size_t offset = out->size();
+				out->resize(offset + num);
+				Ubpa::pointf2* o = out->data() + offset;
+				const float du = 1.0f / num;
+				for (int s = 0; s < num; ++s) {
+					float u = s * du;
+					o[s][0] = ax[0] + u * (ax[1] + u * (ax[2] + u * ax[3]));
+					o[s][1] = ay[0] + u * (ay[1] + u * (ay[2] + u * ay[3]));
+				}
+			}
+			if (!closed) {
+				float u[3] = { 1.0f, 1.0f, 1.0f };
+				out->push_back(blossom(c, d, u));
+			}
+		}
+
+	private:
+		//  l õ P(l-d+1-o) ... P(l+1-o)
+		int firstPiece() const { return d - 1 + o; }
+		int lastPiece() const { return n - 2 + o; }
+
+		void gather(int l, Ubpa::pointf2* c) const {
+			const std::vector<Ubpa::pointf2>& P = *p;
+			const int first = l - d + 1 - o;
+			for (int j = 0; j <= d; ++j) {
+				int i = first + j;
+				if (closed)
+					i = (i % n + n) % n;
+				c[j] = P[i];
+			}
+		}
+
+		const std::vector<Ubpa::pointf2>* p{ nullptr };
+		int n{ 0 };
+		int d{ 0 };
+		int o{ 0 };
+		bool closed{ false };
+	};
+}
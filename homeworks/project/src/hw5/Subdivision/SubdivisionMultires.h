@@ -0,0 +1,269 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "SubdivisionEngine.h"
+#include "SubdivisionLimit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+/**********************************************************************************
+/// @file       SubdivisionMultires.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      Chaikin  B ķϸ֣С
+/// @details     m ߷ֽΪϸǰ n ֵ c  m - n ϸ d f = S c + Q d
+///             S ΪϸһQ Ϊϸڵľֲ˲d Ϊ 0 ʱؽΪͨϸֱֽ֡ƥ䣬
+///             ؽʱֵֻǰ k ϸڣֽؽ O(n)
+**********************************************************************************/
+
+namespace Subdivision {
+	/*
+	/// @brief      m 㷴ϸһĴֵ
+	/// @details     outputSize 棺պʱ m Ϊżպϵ Chaikin ΪżϸΪ
+	/// @param[in]  :
+	/// @return     ƥ䡢ֵ 3 ټʱ 0
+	/// @attention  ֻ֧ Chaikin ϸ
+	*/
+	inline int reverseSize(Scheme scheme, int m, bool close) {
+		int n = 0;
+		if (close)
+			n = m % 2 == 0 ? m / 2 : 0;
+		else if (scheme == Scheme::Chaikin)
+			n = m % 2 == 0 ? (m + 2) / 2 : 0;
+		else if (scheme == Scheme::Cubic)
+			n = m % 2 == 1 ? (m + 3) / 2 : 0;
+		return n >= 3 && n < m ? n : 0;
+	}
+
+	/*
+	/// @brief      ϸһ
+	/// @details    Ապʱ± f
+	///             Chaikinc(i) = (-f(2i-1) + 3 f(2i) + 3 f(2i+1) - f(2i+2)) / 4d(i) = (f(2i-1) - 3 f(2i) + 3 f(2i+1) - f(2i+2)) / 4
+	///             Σc(i) = -f(2i-1) / 2 + 2 f(2i) - f(2i+1) / 2d(i) = f(2i+1) - (c(i) + c(i+1)) / 2
+	///             պʱβֵɶ˵㴦ϸֻڲϸ
+	/// @param[in]  : f : m     coarse : reverseSize     detail : m - reverseSize 
+	/// @return
+	/// @attention  reverseSize(scheme, m, close) > 0
+	*/
+	inline void reverseStep(Scheme scheme, const Ubpa::pointf2* f, int m, bool close, Ubpa::pointf2* coarse, Ubpa::pointf2* detail) {
+		const int n = reverseSize(scheme, m, close);
+		// պʱ f ĵ j Ǳպʱĵ j+1 
+		const int shift = close ? 0 : 1;
+		auto at = [=](int j) -> const Ubpa::pointf2& { return f[((j - shift) % m + m) % m]; };
+		const int i0 = close ? 0 : 1, i1 = close ? n : n - 1;
+		if (scheme == Scheme::Chaikin) {
+			for (int i = i0; i < i1; ++i) {
+				const Ubpa::pointf2 &a = at(2 * i - 1), &b = at(2 * i), &c = at(2 * i + 1), &d = at(2 * i + 2);
+				for (int k = 0; k < 2; ++k) {
+					coarse[i][k] = 0.25f * (-a[k] + 3.0f * b[k] + 3.0f * c[k] - d[k]);
+					detail[i - i0][k] = 0.25f * (a[k] - 3.0f * b[k] + 3.0f * c[k] - d[k]);
+				}
+			}
+			if (!close) {
+				for (int k = 0; k < 2; ++k) {
+					coarse[0][k] = 1.5f * f[0][k] - 0.5f * f[1][k];
+					coarse[n - 1][k] = 1.5f * f[m - 1][k] - 0.5f * f[m - 2][k];
+				}
+			}
+		}
+		else {
+			for (int i = i0; i < i1; ++i) {
+				const Ubpa::pointf2 &a = at(2 * i - 1), &b = at(2 * i), &c = at(2 * i + 1);
+				for (int k = 0; k < 2; ++k)
+					coarse[i][k] = -0.5f * a[k] + 2.0f * b[k] - 0.5f * c[k];
+			}
+			if (!close) {
+				// βıߵ (c(0) + c(1)) / 2  f β
+				for (int k = 0; k < 2; ++k) {
+					coarse[0][k] = 2.0f * f[0][k] - coarse[1][k];
+					coarse[n - 1][k] = 2.0f * f[m - 1][k] - coarse[n - 2][k];
+				}
+			}
+			const int e1 = close ? n : n - 2;
+			for (int i = i0; i < e1; ++i) {
+				const Ubpa::pointf2 &e = at(2 * i + 1), &c0 = coarse[i], &c1 = coarse[(i + 1) % n];
+				for (int k = 0; k < 2; ++k)
+					detail[i - i0][k] = e[k] - 0.5f * (c0[k] + c1[k]);
+			}
+		}
+	}
+
+	/*
+	/// @brief      ɴֵϸؽһ
+	/// @details    ȶԴֵϸһٰϸڰ Q ӻأ
+	///             Chaikin  d(i)  (-1, -3, 3, 1) / 4 ӵ f(2i-1) ... f(2i+2)ε d(i)  (1/4, 1, 1/4) ӵ f(2i) ... f(2i+2)
+	/// @param[in]  : out : outputSize(scheme, n, close) 
+	/// @return
+	/// @attention  detail Ϊ nullptr ʱΪͨϸ
+	*/
+	inline void forwardStep(Scheme scheme, const Ubpa::pointf2* coarse, int n, bool close, const Ubpa::pointf2* detail, Ubpa::pointf2* out) {
+		subdivisionStep(scheme, coarse, n, close, 0.0f, out);
+		if (!detail)
+			return;
+		const int m = outputSize(scheme, n, close);
+		const int shift = close ? 0 : 1;
+		auto add = [=](int j, float w, const Ubpa::pointf2& d) {
+			Ubpa::pointf2& o = out[((j - shift) % m + m) % m];
+			o[0] += w * d[0];
+			o[1] += w * d[1];
+		};
+		const int i0 = close ? 0 : 1;
+		if (scheme == Scheme::Chaikin) {
+			for (int i = i0; i < (close ? n : n - 1); ++i) {
+				const Ubpa::pointf2& d = detail[i - i0];
+				add(2 * i - 1, -0.25f, d);
+				add(2 * i, -0.75f, d);
+				add(2 * i + 1, 0.75f, d);
+				add(2 * i + 2, 0.25f, d);
+			}
+		}
+		else {
+			for (int i = i0; i < (close ? n : n - 2); ++i) {
+				const Ubpa::pointf2& d = detail[i - i0];
+				add(2 * i, 0.25f, d);
+				add(2 * i + 1, 1.0f, d);
+				add(2 * i + 2, 0.25f, d);
+			}
+		}
+	}
+
+	/*
+	/// @brief       m ܷϸ levels 
+	/// @details    ֲĵϸ levels ȡ m 
+	/// @param[in]  :
+	/// @return     m ̫Сʱ 0
+	/// @attention
+	*/
+	inline int decomposableSize(Scheme scheme, int m, bool close, int levels) {
+		auto grow = [=](int n) {
+			for (int k = 0; k < levels; ++k)
+				n = outputSize(scheme, n, close);
+			return n;
+		};
+		int n = std::max(3, (m >> levels) + 3);
+		while (n > 3 && grow(n) > m)
+			--n;
+		return grow(n) <= m ? grow(n) : 0;
+	}
+
+	/*
+	/// @brief      زΪ size 
+	/// @details    պʱĩ㵽׵ıߣ㲻ظ׵㣻պʱβ
+	/// @param[in]  :
+	/// @return
+	/// @attention  ڰ߱Ϊ decomposableSize 㣬ʧ
+	*/
+	inline void resampleArcLength(const std::vector<Ubpa::pointf2>& points, bool close, int size, std::vector<Ubpa::pointf2>* out) {
+		const int m = static_cast<int>(points.size());
+		const int edges = close ? m : m - 1;
+		std::vector<float> arc(edges + 1, 0.0f);
+		for (int e = 0; e < edges; ++e)
+			arc[e + 1] = arc[e] + distance(points[e], points[(e + 1) % m]);
+		out->resize(size);
+		const float step = arc[edges] / (close ? size : size - 1);
+		int e = 0;
+		for (int s = 0; s < size; ++s) {
+			float t = std::min(s * step, arc[edges]);
+			while (e + 1 < edges && arc[e + 1] < t)
+				++e;
+			float len = arc[e + 1] - arc[e];
+			float u = len > 0.0f ? (t - arc[e]) / len : 0.0f;
+			const Ubpa::pointf2 &a = points[e], &b = points[(e + 1) % m];
+			(*out)[s] = Ubpa::pointf2((1.0f - u) * a[0] + u * b[0], (1.0f - u) * a[1] + u * b[1]);
+		}
+	}
+
+	class Multires {
+	public:
+		/*
+		/// @brief      ߷ֽΪֲϸ
+		/// @details    ÿϸһΣֱ maxLevels ƥ
+		/// @param[in]  : scheme : Chaikin  Cubic
+		/// @return     ֽĲ
+		/// @attention
+		*/
+		int Decompose(Scheme scheme, const std::vector<Ubpa::pointf2>& points, bool close, int maxLevels) {
+			this->scheme = scheme;
+			closed = close;
+			// ȴϸϸڣٵʹ details[0] Ϊֲϸ
+			std::vector<std::vector<Ubpa::pointf2>> fineToCoarse;
+			coarse = points;
+			std::vector<Ubpa::pointf2> next;
+			while (static_cast<int>(fineToCoarse.size()) < maxLevels) {
+				const int m = static_cast<int>(coarse.size());
+				const int n = reverseSize(scheme, m, close);
+				if (n == 0)
+					break;
+				next.resize(n);
+				std::vector<Ubpa::pointf2> detail(m - n);
+				reverseStep(scheme, coarse.data(), m, close, next.data(), detail.data());
+				fineToCoarse.push_back(std::move(detail));
+				coarse.swap(next);
+			}
+			details.assign(std::make_move_iterator(fineToCoarse.rbegin()), std::make_move_iterator(fineToCoarse.rend()));
+			return Levels();
+		}
+
+		int Levels() const { return static_cast<int>(details.size()); }
+
+		const std::vector<Ubpa::pointf2>& Coarse() const { return coarse; }
+
+		/*
+		/// @brief      ֲǰ levels ϸؽ
+		/// @details    ʱֻѶĸ㣻levels  Levels() ʱָԭߣһ룩
+		/// @param[in]  :
+		/// @return     ´ε Reconstruct ֮ǰЧ
+		/// @attention  0 <= levels <= Levels()
+		*/
+		const std::vector<Ubpa::pointf2>& Reconstruct(int levels) {
+			buffers[0] = coarse;
+			int cur = 0;
+			for (int k = 0; k < levels; ++k) {
+				const std::vector<Ubpa::pointf2>& src = buffers[cur];
+				std::vector<Ubpa::pointf2>& dst = buffers[1 - cur];
+				int n = static_cast<int>(src.size());
+				dst.resize(outputSize(scheme, n, closed));
+				forwardStep(scheme, src.data(), n, closed, details[k].data(), dst.data());
+				cur = 1 - cur;
+			}
+			return buffers[cur];
+		}
+
+		/*
+		/// @brief      ѳС threshold ϸ
+		/// @details    ƽֵϸڽӽ 0ֻϸڼ±
+		/// @param[in]  :
+		/// @return     ʣķϸڸ
+		/// @attention  Q ÿȨصľֵ֮Ͳ 1ϸֲŴؽ  * threshold
+		*/
+		int Compress(float threshold) {
+			int nonzero = 0;
+			for (auto& level : details) {
+				for (auto& d : level) {
+					if (d[0] * d[0] + d[1] * d[1] < threshold * threshold)
+						d = Ubpa::pointf2(0.0f, 0.0f);
+					else
+						++nonzero;
+				}
+			}
+			return nonzero;
+		}
+
+		// ϸ
+		int DetailCount() const {
+			int count = 0;
+			for (const auto& level : details)
+				count += static_cast<int>(level.size());
+			return count;
+		}
+
+	private:
+		Scheme scheme{ Scheme::Chaikin };
+		bool closed{ false };
+		std::vector<Ubpa::pointf2> coarse;
+		std::vector<std::vector<Ubpa::pointf2>> details;	// details[k] ѵ k ؽΪ k+1 
+		std::vector<Ubpa::pointf2> buffers[2];
+	};
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**********************************************************************************
+/// @file       SubdivisionParallel.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ϸֵķֿ鲢
+/// @details    ÿ㰴±ֳɿ飬ÿһ߳ϸֱֲдĶӦλã
+///             Ҫڵ㣨ģڵĹ⻷ֱӴӹȡҪ
+**********************************************************************************/
+
+namespace Subdivision {
+	// ÿô㣬̫СĿ鲻ֵÿ߳
+	constexpr int PARALLEL_MIN_CHUNK = 1 << 14;
+
+	inline int hardwareThreads() {
+		unsigned n = std::thread::hardware_concurrency();
+		return n > 0 ? static_cast<int>(n) : 1;
+	}
+
+	/*
+	/// @brief       [0, n) ֳ numThreads 鲢ִ f(begin, end)
+	/// @details    һڵִ߳
+	/// @param[in]  :
+	/// @return
+	/// @attention  f ĸεֻдصλ
+	*/
+	template<typename Fun>
+	inline void parallelChunks(int n, int numThreads, Fun&& f) {
+		const int chunks = std::max(1, std::min(numThreads, n / PARALLEL_MIN_CHUNK));
+		if (chunks == 1) {
+			f(0, n);
+			return;
+		}
+		std::vector<std::thread> workers;
+		workers.reserve(chunks - 1);
+		for (int c = 1; c < chunks; ++c) {
+			int begin = static_cast<int>(static_cast<long long>(n) * c / chunks);
+			int end = static_cast<int>(static_cast<long long>(n) * (c + 1) / chunks);
+			workers.emplace_back([&f, begin, end]() { f(begin, end); });
+		}
+		f(0, static_cast<int>(static_cast<long long>(n) / chunks));
+		for (auto& worker : workers)
+			worker.join();
+	}
+}
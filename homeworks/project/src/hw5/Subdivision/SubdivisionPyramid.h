@@ -0,0 +1,123 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "SubdivisionEngine.h"
+
+#include <algorithm>
+#include <vector>
+
+/**********************************************************************************
+/// @file       SubdivisionPyramid.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ϸֽ
+/// @details    ӲʱֻµĲ㣻Ƶ仯ʱӵ 0 ı仯
+///             ֻӰĴڣÿ㰴ģչ
+///             ڳòķ֮һʱΪϸ
+**********************************************************************************/
+
+namespace Subdivision {
+	class Pyramid {
+	public:
+		/*
+		/// @brief      ²ϸ steps Ľ
+		/// @details    ʽպϡalpha 仯ʱؽҳ仯ĿƵ㣬ֻ² steps ĸ㣬
+		///             Ļڱ༭ʱ
+		/// @param[in]  : numThreads : ϸʱֿ鲢е߳
+		/// @return      Engine::Run Ľλͬ´ε Update ֮ǰЧ
+		/// @attention
+		*/
+		const std::vector<Ubpa::pointf2>& Update(Scheme scheme, const std::vector<Ubpa::pointf2>& points, int steps, bool close, float alpha = 0.075f, int numThreads = 1) {
+			this->numThreads = numThreads;
+			const int n = static_cast<int>(points.size());
+			if (levels.empty() || scheme != this->scheme || close != closed || alpha != this->alpha || n != static_cast<int>(levels[0].size())) {
+				this->scheme = scheme;
+				closed = close;
+				this->alpha = alpha;
+				levels.resize(1);
+				levels[0] = points;
+			}
+			else {
+				auto same = [&](int i) { return points[i][0] == levels[0][i][0] && points[i][1] == levels[0][i][1]; };
+				int a = 0, b = n - 1;
+				while (a < n && same(a))
+					++a;
+				while (b > a && same(b))
+					--b;
+				if (a < n) {
+					std::copy(points.begin() + a, points.begin() + b + 1, levels[0].begin() + a);
+					levels.resize(std::min(static_cast<int>(levels.size()), steps + 1));
+					bool full = false;
+					for (int k = 1; k < static_cast<int>(levels.size()); ++k)
+						updateLevel(k, a, b, full);
+				}
+			}
+			while (static_cast<int>(levels.size()) <= steps && levels.back().size() >= 3) {
+				const std::vector<Ubpa::pointf2>& src = levels.back();
+				std::vector<Ubpa::pointf2> dst(outputSize(scheme, static_cast<int>(src.size()), closed));
+				subdivisionStepParallel(scheme, src.data(), static_cast<int>(src.size()), closed, alpha, dst.data(), numThreads);
+				levels.push_back(std::move(dst));
+			}
+			return levels[std::min(steps, static_cast<int>(levels.size()) - 1)];
+		}
+
+		void Clear() { levels.clear(); }
+
+	private:
+		/*
+		/// @brief      һı仯 [lo, hi] µ k 
+		/// @details    ñպʱ±ʾպ벻պϵĵϸְƴպʱеĩ㣩
+		///             պϵ Chaikin ϸǰһλضϣʱ [lo, hi] Ϊı仯
+		/// @param[in]  :
+		/// @return
+		/// @attention  full Ϊ true ʱ㼰Ժϸ
+		*/
+		void updateLevel(int k, int& lo, int& hi, bool& full) {
+			const std::vector<Ubpa::pointf2>& src = levels[k - 1];
+			std::vector<Ubpa::pointf2>& dst = levels[k];
+			const int n = static_cast<int>(src.size());
+			const int m = static_cast<int>(dst.size());
+			// һӰ㣬Ապʱ±
+			int left, right;
+			switch (scheme) {
+			case Scheme::Chaikin: left = 1; right = 2; break;
+			case Scheme::Cubic: left = 2; right = 2; break;
+			default: left = 3; right = 3; break;
+			}
+			int j0 = 2 * lo - left, j1 = 2 * hi + right;
+			if (!full && 4 * (j1 - j0 + 1) >= m)
+				full = true;
+			if (full) {
+				subdivisionStepParallel(scheme, src.data(), n, closed, alpha, dst.data(), numThreads);
+				return;
+			}
+
+			if (closed || scheme == Scheme::Quad) {
+				const int ring = 2 * n;
+				int first = -1, count = 0;
+				for (int j = j0; j <= j1; ++j) {
+					int jm = (j % ring + ring) % ring;
+					if (jm >= m)
+						continue;
+					subdivisionPoint(scheme, src.data(), n, closed, alpha, jm, dst[jm]);
+					if (first < 0)
+						first = jm;
+					++count;
+				}
+				lo = first;
+				hi = first + count - 1;
+			}
+			else {
+				lo = std::max(j0 - 1, 0);
+				hi = std::min(j1 - 1, m - 1);
+				for (int j = lo; j <= hi; ++j)
+					subdivisionPoint(scheme, src.data(), n, closed, alpha, j, dst[j]);
+			}
+		}
+
+		std::vector<std::vector<Ubpa::pointf2>> levels;	// levels[0] ΪƵ
+		Scheme scheme{ Scheme::Chaikin };
+		bool closed{ false };
+		float alpha{ 0.075f };
+		int numThreads{ 1 };
+	};
+}
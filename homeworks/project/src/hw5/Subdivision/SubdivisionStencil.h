@@ -0,0 +1,333 @@
+#pragma once
+#include <UGM/UGM.h>
+#include "SubdivisionParallel.h"
+
+#include <algorithm>
+#include <vector>
+
+/**********************************************************************************
+/// @file       SubdivisionStencil.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ģϸָʽ
+/// @details    һʽ arity ɣ r 
+///             out[arity * i + r] = sum_k weights[r][k] * P(i + offset + k)
+///             Ȩ constexprڲѭչɹ̶ĳ˼ӣ
+///             պʱ±ƻأպʱֻģȫڶڵĵ
+**********************************************************************************/
+
+namespace Subdivision {
+	// Chaikin B 
+	struct ChaikinStencil {
+		static constexpr int arity = 2;
+		static constexpr int offset = -1;
+		static constexpr int width = 3;
+		static constexpr float weights[arity][width] = {
+			{ 0.25f, 0.75f, 0.0f },
+			{ 0.0f, 0.75f, 0.25f },
+		};
+	};
+
+	//  B 
+	struct CubicStencil {
+		static constexpr int arity = 2;
+		static constexpr int offset = -1;
+		static constexpr int width = 3;
+		static constexpr float weights[arity][width] = {
+			{ 0.125f, 0.75f, 0.125f },
+			{ 0.0f, 0.5f, 0.5f },
+		};
+	};
+
+	// ĵֵϸ֣w = 1/16
+	struct FourPointStencil {
+		static constexpr int arity = 2;
+		static constexpr int offset = -1;
+		static constexpr int width = 4;
+		static constexpr float weights[arity][width] = {
+			{ 0.0f, 1.0f, 0.0f, 0.0f },
+			{ -1.0f / 16, 9.0f / 16, 9.0f / 16, -1.0f / 16 },
+		};
+	};
+
+	// Dyn-Levin ֵϸ֣(3, -25, 150, 150, -25, 3) / 256
+	struct SixPointStencil {
+		static constexpr int arity = 2;
+		static constexpr int offset = -2;
+		static constexpr int width = 6;
+		static constexpr float weights[arity][width] = {
+			{ 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f },
+			{ 3.0f / 256, -25.0f / 256, 150.0f / 256, 150.0f / 256, -25.0f / 256, 3.0f / 256 },
+		};
+	};
+
+	// Hassan-Dodgson ĵֵϸ֣mu = 1/11C2
+	struct TernaryStencil {
+		static constexpr int arity = 3;
+		static constexpr int offset = -1;
+		static constexpr int width = 4;
+		static constexpr float weights[arity][width] = {
+			{ 0.0f, 1.0f, 0.0f, 0.0f },
+			{ -14.0f / 198, 152.0f / 198, 68.0f / 198, -8.0f / 198 },
+			{ -8.0f / 198, 68.0f / 198, 152.0f / 198, -14.0f / 198 },
+		};
+	};
+
+	namespace details {
+		constexpr int constexprPow(int base, int exp) {
+			int result = 1;
+			for (int i = 0; i < exp; ++i)
+				result *= base;
+			return result;
+		}
+
+		//  r ĵһһȨ
+		template<typename S>
+		constexpr int ruleBegin(int r) {
+			int k = 0;
+			while (k < S::width && S::weights[r][k] == 0.0f)
+				++k;
+			return k;
+		}
+
+		template<typename S>
+		constexpr int ruleEnd(int r) {
+			int k = S::width - 1;
+			while (k > 0 && S::weights[r][k] == 0.0f)
+				--k;
+			return k;
+		}
+
+		// йķ㷶ΧĲ
+		template<typename S, int R = 0>
+		constexpr int supportBegin() {
+			if constexpr (R + 1 < S::arity)
+				return std::min(ruleBegin<S>(R), supportBegin<S, R + 1>());
+			else
+				return ruleBegin<S>(R);
+		}
+
+		template<typename S, int R = 0>
+		constexpr int supportEnd() {
+			if constexpr (R + 1 < S::arity)
+				return std::max(ruleEnd<S>(R), supportEnd<S, R + 1>());
+			else
+				return ruleEnd<S>(R);
+		}
+
+		template<typename S, int R, int K>
+		inline void accumulate(const Ubpa::pointf2* q, float& x, float& y) {
+			if constexpr (K <= ruleEnd<S>(R)) {
+				if constexpr (S::weights[R][K] != 0.0f) {
+					x += S::weights[R][K] * q[K][0];
+					y += S::weights[R][K] * q[K][1];
+				}
+				accumulate<S, R, K + 1>(q, x, y);
+			}
+		}
+
+		// q ָ P(i + offset)չֻʣȨصĳ˼ӣȨΪ 1 ĹֱӸ
+		template<typename S, int R>
+		inline void applyRule(const Ubpa::pointf2* q, Ubpa::pointf2& o) {
+			constexpr int k0 = ruleBegin<S>(R);
+			if constexpr (k0 == ruleEnd<S>(R) && S::weights[R][k0] == 1.0f) {
+				o = q[k0];
+			}
+			else {
+				float x = S::weights[R][k0] * q[k0][0];
+				float y = S::weights[R][k0] * q[k0][1];
+				accumulate<S, R, k0 + 1>(q, x, y);
+				o[0] = x;
+				o[1] = y;
+			}
+		}
+
+		template<typename S, int R = 0>
+		inline void applyRules(const Ubpa::pointf2* q, Ubpa::pointf2* o) {
+			if constexpr (R < S::arity) {
+				applyRule<S, R>(q, o[R]);
+				applyRules<S, R + 1>(q, o);
+			}
+		}
+
+		// ߽紦ִֻ r  pred(r) Ĺд oдĸ
+		template<typename S, int R = 0, typename Pred>
+		inline int applyRulesIf(const Ubpa::pointf2* q, Ubpa::pointf2* o, Pred&& pred) {
+			if constexpr (R < S::arity) {
+				int count = 0;
+				if (pred(R)) {
+					applyRule<S, R>(q, o[0]);
+					count = 1;
+				}
+				return count + applyRulesIf<S, R + 1>(q, o + count, pred);
+			}
+			else
+				return 0;
+		}
+	}
+
+	namespace details {
+		/*
+		/// @brief       4 ıպϸһλ壬ص Steps  1 ķŴ֮
+		/// @details     k  Order ײֳ arity^(k * Order) C^Order ʱֵн磻
+		///             Ȩдʱֵ沽
+		/// @param[in]  :
+		/// @return
+		/// @attention  ֵֻ static_assert
+		*/
+		template<typename S, int Order, int Steps>
+		constexpr double scaledDifferenceGrowth() {
+			constexpr int size = 512;
+			static_assert(4 * constexprPow(S::arity, Steps) <= size, "too many steps");
+			double p[size]{}, q[size]{};
+			int n = 4;
+			p[0] = 1.0;
+			double scale = 1.0, first = 0.0, last = 0.0;
+			for (int step = 1; step <= Steps; ++step) {
+				for (int i = 0; i < n; ++i) {
+					for (int r = 0; r < S::arity; ++r) {
+						double v = 0.0;
+						for (int k = 0; k < S::width; ++k)
+							v += S::weights[r][k] * p[((i + S::offset + k) % n + n) % n];
+						q[S::arity * i + r] = v;
+					}
+				}
+				n *= S::arity;
+				for (int i = 0; i < n; ++i)
+					p[i] = q[i];
+				for (int o = 0; o < Order; ++o) {
+					const double q0 = q[0];
+					for (int i = 0; i + 1 < n; ++i)
+						q[i] = q[i + 1] - q[i];
+					q[n - 1] = q0 - q[n - 1];
+					scale *= S::arity;
+				}
+				double m = 0.0;
+				for (int i = 0; i < n; ++i)
+					m = std::max(m, q[i] < 0.0 ? -q[i] : q[i]);
+				last = m * scale;
+				if (step == 1)
+					first = last;
+			}
+			return last / first;
+		}
+	}
+
+	// ȨرĹ⻬Լ飬C1 ĸʽһײ֣C2 ټײ
+	static_assert(details::scaledDifferenceGrowth<ChaikinStencil, 1, 6>() < 3.0, "Chaikin stencil is not C1");
+	static_assert(details::scaledDifferenceGrowth<CubicStencil, 1, 6>() < 3.0, "cubic stencil is not C1");
+	static_assert(details::scaledDifferenceGrowth<CubicStencil, 2, 6>() < 3.0, "cubic stencil is not C2");
+	static_assert(details::scaledDifferenceGrowth<FourPointStencil, 1, 6>() < 3.0, "four-point stencil is not C1");
+	static_assert(details::scaledDifferenceGrowth<SixPointStencil, 1, 6>() < 3.0, "six-point stencil is not C1");
+	static_assert(details::scaledDifferenceGrowth<SixPointStencil, 2, 6>() < 3.0, "six-point stencil is not C2");
+	static_assert(details::scaledDifferenceGrowth<TernaryStencil, 1, 4>() < 3.0, "ternary stencil is not C1");
+	static_assert(details::scaledDifferenceGrowth<TernaryStencil, 2, 4>() < 3.0, "ternary stencil is not C2");
+
+	// n ϸһĵ
+	template<typename S>
+	inline int stencilOutputSize(int n, bool close) {
+		if (close)
+			return S::arity * n;
+		int size = 0;
+		for (int r = 0; r < S::arity; ++r)
+			size += std::max(0, n - (details::ruleEnd<S>(r) - details::ruleBegin<S>(r)));
+		return size;
+	}
+
+	/*
+	/// @brief       i ĵһڽе±
+	/// @details    պʱΪ arity * iպʱΪ i ֮ǰĵ֮
+	/// @param[in]  :
+	/// @return
+	/// @attention  0 <= i <= n
+	*/
+	template<typename S>
+	inline int stencilOutputOffset(int i, int n, bool close) {
+		if (close)
+			return S::arity * i;
+		int offset = 0;
+		for (int r = 0; r < S::arity; ++r) {
+			//  r  [first, last] ڵ i 
+			int first = std::max(0, -(S::offset + details::ruleBegin<S>(r)));
+			int last = n - 1 - (S::offset + details::ruleEnd<S>(r));
+			offset += std::max(0, std::min(i - 1, last) - first + 1);
+		}
+		return offset;
+	}
+
+	/*
+	/// @brief      ʽ S ϸһ [begin, end) ӦĲ
+	/// @details    ģȫڶڵ i չڲѭ i պʱƻصĵ㳭С
+	///             պʱִֻзȨضڶڵĹڵֱӴ p ͬԲ
+	/// @param[in]  : p : n     out : stencilOutputSize<S>(n, close) 㣬ֻдĲ
+	/// @return
+	/// @attention  n >= S::width
+	*/
+	template<typename S>
+	inline void stencilStepRange(const Ubpa::pointf2* p, int n, bool close, Ubpa::pointf2* out, int begin, int end) {
+		constexpr int lo = details::supportBegin<S>() + S::offset;	//  i ±
+		constexpr int hi = details::supportEnd<S>() + S::offset;	//  i ±
+		const int i0 = std::min(std::max(begin, -lo), end), i1 = std::max(std::min(end, n - hi), i0);	// ڲ [i0, i1)
+
+		auto boundary = [&](int i, Ubpa::pointf2* o) -> int {
+			if (close) {
+				Ubpa::pointf2 window[S::width];
+				for (int k = 0; k < S::width; ++k)
+					window[k] = p[((i + S::offset + k) % n + n) % n];
+				details::applyRules<S>(window, o);
+				return S::arity;
+			}
+			const Ubpa::pointf2* q = p + (i + S::offset);
+			return details::applyRulesIf<S>(q, o, [=](int r) {
+				return i + S::offset + details::ruleBegin<S>(r) >= 0 && i + S::offset + details::ruleEnd<S>(r) < n;
+			});
+		};
+
+		Ubpa::pointf2* o = out + stencilOutputOffset<S>(begin, n, close);
+		for (int i = begin; i < i0; ++i)
+			o += boundary(i, o);
+		for (int i = i0; i < i1; ++i, o += S::arity)
+			details::applyRules<S>(p + (i + S::offset), o);
+		for (int i = i1; i < end; ++i)
+			o += boundary(i, o);
+	}
+
+	template<typename S>
+	inline void stencilStep(const Ubpa::pointf2* p, int n, bool close, Ubpa::pointf2* out) {
+		stencilStepRange<S>(p, n, close, out, 0, n);
+	}
+
+	// ֳ numThreads ϸ֣ stencilStep λͬ
+	template<typename S>
+	inline void stencilStepParallel(const Ubpa::pointf2* p, int n, bool close, Ubpa::pointf2* out, int numThreads) {
+		parallelChunks(n, numThreads, [=](int begin, int end) { stencilStepRange<S>(p, n, close, out, begin, end); });
+	}
+
+	template<typename S>
+	class StencilEngine {
+	public:
+		/*
+		/// @brief       points ϸ steps 
+		/// @details     Engine ͬ黺彻Ϊ
+		/// @param[in]  : numThreads :  1 ʱÿֿ鲢
+		/// @return     ϸֽ´ε Run ֮ǰЧ
+		/// @attention  ģʱϸ
+		*/
+		const std::vector<Ubpa::pointf2>& Run(const std::vector<Ubpa::pointf2>& points, int steps, bool close, int numThreads = 1) {
+			buffers[0].assign(points.begin(), points.end());
+			int cur = 0;
+			for (int st = 0; st < steps && static_cast<int>(buffers[cur].size()) >= S::width; ++st) {
+				const std::vector<Ubpa::pointf2>& src = buffers[cur];
+				std::vector<Ubpa::pointf2>& dst = buffers[1 - cur];
+				int n = static_cast<int>(src.size());
+				dst.resize(stencilOutputSize<S>(n, close));
+				stencilStepParallel<S>(src.data(), n, close, dst.data(), numThreads);
+				cur = 1 - cur;
+			}
+			return buffers[cur];
+		}
+
+	private:
+		std::vector<Ubpa::pointf2> buffers[2];
+	};
+}
@@ -1,28 +1,262 @@
 #include "CanvasSystem.h"
 
 #include "../Components/CanvasData.h"
+#include "../Components/CurveData.h"
 #include "../Subdivision/Subdivision.h"
+#include "../Subdivision/SubdivisionEngine.h"
+#include "../Subdivision/SubdivisionLimit.h"
+#include "../Subdivision/SubdivisionMultires.h"
+#include "../Subdivision/SubdivisionPyramid.h"
+#include "../Subdivision/SubdivisionStencil.h"
 
 #include <_deps/imgui/imgui.h>
-#include "../ImGuiFileBrowser.h"
+#include "../../common/ImGuiFileBrowser/ImGuiFileBrowser.h"
 #include "spdlog/spdlog.h"
+#include "../../common/Polyline/lod.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
 #include <fstream>
 
 
 using namespace Ubpa;
 
-constexpr auto MAX_PLOT_NUM_POINTS = 10000;
+constexpr auto LIMIT_SPACING = 2.0f;	// ֱʱĲࣨأ
+constexpr auto MULTIRES_MAX_LEVELS = 12;
+constexpr auto MULTIRES_FIT_LEVELS = 6;	// fit ʱزֽܷĲ
 
 imgui_addons::ImGuiFileBrowser file_dialog;
+Polyline::LOD lod;	// ύǰĻռ
 
 bool chaikin = true;
 bool cubic = false;
 bool quad_ = false;
+bool sixPoint = false;
+bool ternary = false;
 bool closed = false;
 int step_num = 3;
 int alpha = 12;
 bool originPoints = true;
+bool limit = false;
+bool parallel = false;	// ϸʱӲֿ߳鲢
+bool multires = false;
+int multiresLevel = 0;
+
+Subdivision::Pyramid chaikinPyramid, cubicPyramid, quadPyramid;	// Իÿϸֽ
+Subdivision::StencilEngine<Subdivision::SixPointStencil> sixPointEngine;
+Subdivision::StencilEngine<Subdivision::TernaryStencil> ternaryEngine;
+std::vector<ImVec2> subdiv_ps;	// ϸֽĻ
+Subdivision::LimitEvaluator limitEvaluator;
+std::vector<Ubpa::pointf2> limitPoints;
+Subdivision::Multires multiresCurve;	// ݵ Chaikin ϸ
+std::vector<Ubpa::pointf2> multiresInput;	// ϴηֽݵ㣬仯ʱ·ֽ
+bool multiresClosed = false;
+std::vector<ImVec2> curvePolyline;	// õĻ
+
+int numThreads() { return parallel ? Subdivision::hardwareThreads() : 1; }
+
+// ڱ༭ߴΪһʵ壬صӵ״̬
+void stashCurve(Ubpa::UECS::World* w, CanvasData* data) {
+	if (data->points.size()) {
+		auto [e, knots, tess] = w->entityMngr.Create<CurveKnots, CurveTessellation>();
+		knots->points = std::move(data->points);
+		knots->chaikin = chaikin;
+		knots->cubic = cubic;
+		knots->quad = quad_;
+		knots->sixPoint = sixPoint;
+		knots->ternary = ternary;
+		knots->closed = closed;
+		knots->step_num = step_num;
+		knots->alpha = alpha;
+	}
+	data->points.clear();
+	data->isEnd = false;
+}
+
+// ʵȡػ༭ǰߴΪʵ壬ȡصʵɾ
+void loadCurve(Ubpa::UECS::World* w, CanvasData* data, Ubpa::UECS::Entity e, CurveKnots&& knots) {
+	stashCurve(w, data);
+	w->entityMngr.Destroy(e);
+	data->points = std::move(knots.points);
+	data->isEnd = true;
+	chaikin = knots.chaikin;
+	cubic = knots.cubic;
+	quad_ = knots.quad;
+	sixPoint = knots.sixPoint;
+	ternary = knots.ternary;
+	closed = knots.closed;
+	step_num = knots.step_num;
+	alpha = knots.alpha;
+}
+
+// 㵽ߵľƽֻһʱΪõľƽ
+// 㣬ܿ Subdivision.h  pointf2 ֮ȫ
+float distance2ToPolyline(const std::vector<Ubpa::pointf2>& polyline, const Ubpa::pointf2& p) {
+	float best = FLT_MAX;
+	for (int k = 0; k < polyline.size(); ++k) {
+		const Ubpa::pointf2& a = polyline[k];
+		const Ubpa::pointf2& b = polyline[std::min(k + 1, static_cast<int>(polyline.size()) - 1)];
+		float ex = b[0] - a[0], ey = b[1] - a[1];
+		float len2 = ex * ex + ey * ey;
+		float u = len2 > 0.0f ? std::min(std::max(((p[0] - a[0]) * ex + (p[1] - a[1]) * ey) / len2, 0.0f), 1.0f) : 0.0f;
+		float dx = p[0] - (a[0] + ex * u), dy = p[1] - (a[1] + ey * u);
+		best = std::min(best, dx * dx + dy * dy);
+	}
+	return best;
+}
+
+/*
+/// @brief      Ҫϸ
+/// @details    ѡ limit ʱ Chaikin ϸְĻֱܶӲߣӽȡϸ step_num Ĳ㣬
+///             ֻĲ϶ĵӰ쵽ĴҪ
+/// @param[in]  :
+/// @return     ´εǰЧ
+/// @attention
+*/
+const std::vector<Ubpa::pointf2>& subdivide(Subdivision::Scheme scheme, Subdivision::Pyramid& pyramid, const std::vector<Ubpa::pointf2>& points) {
+	if (limit && limitEvaluator.Reset(scheme, points, closed)) {
+		limitEvaluator.Sample(LIMIT_SPACING, &limitPoints);
+		return limitPoints;
+	}
+	return pyramid.Update(scheme, points, step_num, closed, 1.0f / alpha, numThreads());
+}
+
+/*
+/// @brief      ϸܲ
+/// @details    1000 ϸ 10 Լ 10^6 㣩Ƚ½ʵ˫ʵ֣
+///             ٲƶһƵĸʱ䣬ƽϸͬļֱӲȽϣ
+///             ٶ 10^5 Ƚϵ߳߳ϸ֣ 2^20 ķϸؽ־
+/// @param[in]  :
+/// @return
+/// @attention
+*/
+void benchmark() {
+	const int num = 1000, steps = 10, repeat = 5;
+	std::vector<Ubpa::pointf2> points(num);
+	for (int i = 0; i < num; ++i)
+		points[i] = Ubpa::pointf2(500.0f * Ubpa::rand01<float>(), 500.0f * Ubpa::rand01<float>());
+
+	const char* names[3] = { "Chaikin", "cubic", "quad" };
+	Subdivision::Engine engine;
+	for (int scheme = 0; scheme < 3; ++scheme) {
+		auto t0 = std::chrono::high_resolution_clock::now();
+		size_t size = 0;
+		for (int r = 0; r < repeat; ++r) {
+			std::vector<Ubpa::pointf2> p = points;
+			for (int st = 0; st < steps; ++st) {
+				if (scheme == 0) p = Subdivision::Chaikin_subdivision(&p, true);
+				if (scheme == 1) p = Subdivision::cubic_subdivision(&p, true);
+				if (scheme == 2) p = Subdivision::quad_subdivision(&p, true, 1.0f / alpha);
+			}
+			size = p.size();
+		}
+		auto t1 = std::chrono::high_resolution_clock::now();
+		for (int r = 0; r < repeat; ++r)
+			engine.Run(static_cast<Subdivision::Scheme>(scheme), points, steps, true, 1.0f / alpha);
+		auto t2 = std::chrono::high_resolution_clock::now();
+
+		double legacy = std::chrono::duration<double, std::milli>(t1 - t0).count() / repeat;
+		double pingpong = std::chrono::duration<double, std::milli>(t2 - t1).count() / repeat;
+		spdlog::info("{}: {} points, vector per step {:.2f} ms ({:.1f} Mpts/s), ping-pong {:.2f} ms ({:.1f} Mpts/s)",
+			names[scheme], size, legacy, size / legacy / 1000.0, pingpong, size / pingpong / 1000.0);
+
+		// ÿƶһƵ㣬ֻӰĴ
+		Subdivision::Pyramid pyramid;
+		std::vector<Ubpa::pointf2> dragged = points;
+		pyramid.Update(static_cast<Subdivision::Scheme>(scheme), dragged, steps, true, 1.0f / alpha);
+		auto t5 = std::chrono::high_resolution_clock::now();
+		for (int r = 0; r < 100; ++r) {
+			dragged[r * 7 % num][0] += 1.0f;
+			pyramid.Update(static_cast<Subdivision::Scheme>(scheme), dragged, steps, true, 1.0f / alpha);
+		}
+		auto t6 = std::chrono::high_resolution_clock::now();
+		spdlog::info("{}: move one point, pyramid {:.3f} ms", names[scheme], std::chrono::duration<double, std::milli>(t6 - t5).count() / 100);
+
+		Subdivision::LimitEvaluator evaluator;
+		if (!evaluator.Reset(static_cast<Subdivision::Scheme>(scheme), points, true))
+			continue;
+		// ȡƶܳ / ʹϸֽ൱
+		float perimeter = 0.0f;
+		for (int i = 0; i < num; ++i)
+			perimeter += Subdivision::distance(points[i], points[(i + 1) % num]);
+		std::vector<Ubpa::pointf2> samples;
+		auto t3 = std::chrono::high_resolution_clock::now();
+		for (int r = 0; r < repeat; ++r)
+			evaluator.Sample(perimeter / size, &samples);
+		auto t4 = std::chrono::high_resolution_clock::now();
+		double direct = std::chrono::duration<double, std::milli>(t4 - t3).count() / repeat;
+		spdlog::info("{}: {} limit samples, direct {:.2f} ms ({:.1f} Mpts/s)", names[scheme], samples.size(), direct, samples.size() / direct / 1000.0);
+	}
+
+	// ģɵĸʽָʽϸ 6 ʹ൱
+	auto stencilBenchmark = [&](const char* name, auto&& run) {
+		auto t0 = std::chrono::high_resolution_clock::now();
+		size_t size = 0;
+		for (int r = 0; r < repeat; ++r)
+			size = run().size();
+		auto t1 = std::chrono::high_resolution_clock::now();
+		double ms = std::chrono::duration<double, std::milli>(t1 - t0).count() / repeat;
+		spdlog::info("stencil {}: {} points, {:.2f} ms ({:.1f} Mpts/s)", name, size, ms, size / ms / 1000.0);
+	};
+	Subdivision::StencilEngine<Subdivision::ChaikinStencil> chaikinStencil;
+	Subdivision::StencilEngine<Subdivision::CubicStencil> cubicStencil;
+	Subdivision::StencilEngine<Subdivision::FourPointStencil> fourPointStencil;
+	Subdivision::StencilEngine<Subdivision::SixPointStencil> sixPointStencil;
+	Subdivision::StencilEngine<Subdivision::TernaryStencil> ternaryStencil;
+	stencilBenchmark("Chaikin", [&]() -> const auto& { return chaikinStencil.Run(points, steps, true); });
+	stencilBenchmark("cubic", [&]() -> const auto& { return cubicStencil.Run(points, steps, true); });
+	stencilBenchmark("4-point", [&]() -> const auto& { return fourPointStencil.Run(points, steps, true); });
+	stencilBenchmark("6-point", [&]() -> const auto& { return sixPointStencil.Run(points, steps, true); });
+	stencilBenchmark("ternary", [&]() -> const auto& { return ternaryStencil.Run(points, 6, true); });
+
+	// ƶϵ߳߳ϸ֣λͬ
+	const int largeNum = 100000, largeSteps = 4, threads = Subdivision::hardwareThreads();
+	std::vector<Ubpa::pointf2> large(largeNum);
+	for (int i = 0; i < largeNum; ++i)
+		large[i] = Ubpa::pointf2(500.0f * Ubpa::rand01<float>(), 500.0f * Ubpa::rand01<float>());
+	Subdivision::Engine serialEngine, parallelEngine;
+	for (int scheme = 0; scheme < 3; ++scheme) {
+		auto t0 = std::chrono::high_resolution_clock::now();
+		for (int r = 0; r < repeat; ++r)
+			serialEngine.Run(static_cast<Subdivision::Scheme>(scheme), large, largeSteps, true, 1.0f / alpha);
+		auto t1 = std::chrono::high_resolution_clock::now();
+		for (int r = 0; r < repeat; ++r)
+			parallelEngine.Run(static_cast<Subdivision::Scheme>(scheme), large, largeSteps, true, 1.0f / alpha, threads);
+		auto t2 = std::chrono::high_resolution_clock::now();
+		const std::vector<Ubpa::pointf2>& a = serialEngine.Run(static_cast<Subdivision::Scheme>(scheme), large, largeSteps, false, 1.0f / alpha);
+		const std::vector<Ubpa::pointf2>& b = parallelEngine.Run(static_cast<Subdivision::Scheme>(scheme), large, largeSteps, false, 1.0f / alpha, threads);
+		bool same = a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(Ubpa::pointf2)) == 0;
+		double serial = std::chrono::duration<double, std::milli>(t1 - t0).count() / repeat;
+		double threaded = std::chrono::duration<double, std::milli>(t2 - t1).count() / repeat;
+		spdlog::info("{}: {} points, 1 thread {:.2f} ms, {} threads {:.2f} ms ({:.2f}x), identical: {}",
+			names[scheme], a.size(), serial, threads, threaded, serial / threaded, same);
+	}
+
+	// ⻬ıպֽ⵽ֲ㣬ؽѹС 0.01 ϸ
+	const int contourNum = 1 << 20;
+	std::vector<Ubpa::pointf2> contour(contourNum);
+	for (int i = 0; i < contourNum; ++i) {
+		float t = 6.2831853f * i / contourNum;
+		contour[i] = Ubpa::pointf2(250.0f + 200.0f * cosf(t) + 3.0f * sinf(37.0f * t), 250.0f + 200.0f * sinf(t));
+	}
+	for (int scheme = 0; scheme < 2; ++scheme) {
+		Subdivision::Multires multiresBench;
+		auto t0 = std::chrono::high_resolution_clock::now();
+		int levels = multiresBench.Decompose(static_cast<Subdivision::Scheme>(scheme), contour, true, MULTIRES_MAX_LEVELS);
+		auto t1 = std::chrono::high_resolution_clock::now();
+		const std::vector<Ubpa::pointf2>& r = multiresBench.Reconstruct(levels);
+		auto t2 = std::chrono::high_resolution_clock::now();
+		float error = 0.0f;
+		for (int i = 0; i < contourNum; ++i)
+			error = std::max(error, Subdivision::distance(r[i], contour[i]));
+		int nonzero = multiresBench.Compress(0.01f);
+		spdlog::info("{} multires: {} points, {} levels, coarse {}, decompose {:.2f} ms, reconstruct {:.2f} ms, error {:.2g}, {} / {} details above 0.01",
+			names[scheme], contourNum, levels, multiresBench.Coarse().size(), std::chrono::duration<double, std::milli>(t1 - t0).count(),
+			std::chrono::duration<double, std::milli>(t2 - t1).count(), error, nonzero, multiresBench.DetailCount());
+	}
+}
 
 
 void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
@@ -49,6 +283,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				ImGui::Text("USER GUIDE:");
 				ImGui::BulletText("Mouse Left: click to add points.");
 				ImGui::BulletText("Mouse Right: drag to scroll, click for context menu.");
+				ImGui::BulletText("Ctrl + Mouse Left: pick another curve to edit.");
 				ImGui::BulletText("Ctrl+O: Import Data");
 				ImGui::BulletText("Ctrl+S: Export Data");
 				ImGui::Separator();
@@ -57,10 +292,11 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 
 			ImGui::Checkbox("Enable grid", &data->opt_enable_grid); ImGui::SameLine(200);
 			ImGui::Checkbox("Enable context menu", &data->opt_enable_context_menu);
+			lod.ShowControls();
 
 			ImGui::Separator();
 
-			ImGui::BeginChild("order_als_id", ImVec2(200, 200));
+			ImGui::BeginChild("order_als_id", ImVec2(200, 380));
 			ImGui::Checkbox("origin", &originPoints);
 			ImGui::Checkbox("Chaikin", &chaikin);
 			ImGui::Checkbox("cubic", &cubic);
@@ -68,8 +304,25 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			ImGui::InputInt("step_num", &step_num);
 			step_num = step_num < 0 ? 0 : step_num;
 			step_num = step_num > 10 ? 10 : step_num;
+			ImGui::Checkbox("limit", &limit);
 			ImGui::Checkbox("quad", &quad_);
 			ImGui::SliderInt("alpha", &alpha, 1, 32, "alpha = 1/%d");
+			ImGui::Checkbox("6-point", &sixPoint);
+			ImGui::Checkbox("ternary", &ternary);
+			ImGui::Checkbox("parallel", &parallel);
+			ImGui::Checkbox("multires", &multires); ImGui::SameLine();
+			if (ImGui::Button("fit")) {
+				// ݵ㰴زΪܷϸ MULTIRES_FIT_LEVELS ĵ
+				int size = Subdivision::decomposableSize(Subdivision::Scheme::Chaikin, static_cast<int>(data->points.size()), closed, MULTIRES_FIT_LEVELS);
+				if (size > 0) {
+					std::vector<Ubpa::pointf2> resampled;
+					Subdivision::resampleArcLength(data->points, closed, size, &resampled);
+					data->points = std::move(resampled);
+				}
+			}
+			ImGui::SliderInt("level", &multiresLevel, 0, multiresCurve.Levels());
+			ImGui::Text("coarse %d, details %d", static_cast<int>(multiresCurve.Coarse().size()), multiresCurve.DetailCount());
+			if (ImGui::Button("Benchmark")) { benchmark(); }
 			ImGui::EndChild(); ImGui::SameLine(250);
 
 			ImVec2 canvas_p0 = ImGui::GetCursorScreenPos();      // ImDrawList API uses screen coordinates!
@@ -90,12 +343,38 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			const bool is_active = ImGui::IsItemActive();   // Held
 			const ImVec2 origin(canvas_p0.x + data->scrolling[0], canvas_p0.y + data->scrolling[1]); // Lock scrolled origin
 			const pointf2 mouse_pos_in_canvas(io.MousePos.x - origin.x, io.MousePos.y - origin.y);
+			data->viewMin = valf2(canvas_p0.x - origin.x, canvas_p0.y - origin.y);
+			data->viewMax = valf2(canvas_p1.x - origin.x, canvas_p1.y - origin.y);
+
+			// Ctrl + ȡ߽б༭
+			if (is_hovered && io.KeyCtrl && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+				const float pick_radius = 7;
+				float best = pick_radius * pick_radius;
+				Ubpa::UECS::Entity picked;
+				CurveKnots pickedKnots;
+				w->RunEntityJob([&](Ubpa::UECS::Entity e, const CurveKnots* knots, const CurveTessellation* tess) {
+					if (tess->version != knots->version
+						|| mouse_pos_in_canvas[0] < tess->lo[0] - pick_radius || mouse_pos_in_canvas[0] > tess->hi[0] + pick_radius
+						|| mouse_pos_in_canvas[1] < tess->lo[1] - pick_radius || mouse_pos_in_canvas[1] > tess->hi[1] + pick_radius)
+						return;
+					for (const auto& polyline : tess->polylines) {
+						float d2 = distance2ToPolyline(polyline, mouse_pos_in_canvas);
+						if (d2 < best) {
+							best = d2;
+							picked = e;
+							pickedKnots = *knots;
+						}
+					}
+				}, false);
+				if (pickedKnots.points.size())
+					loadCurve(w, data, picked, std::move(pickedKnots));
+			}
 
 			// add a point
 			if (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) { 
 				data->isEnd = true;
 			}	// ˫
-			if (is_hovered && !data->isEnd && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+			if (is_hovered && !data->isEnd && !io.KeyCtrl && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
 				data->points.push_back(mouse_pos_in_canvas);
 				spdlog::info("Point added at: {}, {}", data->points.back()[0], data->points.back()[1]);
 			}
@@ -155,6 +434,9 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 				if (ImGui::MenuItem("Remove all", NULL, false, data->points.size() > 0)) {
 					data->points.clear();
 				}
+				if (ImGui::MenuItem("New curve", NULL, false, data->points.size() > 0)) {
+					stashCurve(w, data);
+				}
 				if (ImGui::MenuItem("Add...", NULL, false)) {
 					data->isEnd = false;
 				}
@@ -163,6 +445,7 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 
 			// Draw grid + all lines in the canvas
 			draw_list->PushClipRect(canvas_p0, canvas_p1, true);
+			lod.BeginFrame(canvas_p0, canvas_p1);
 			if (data->opt_enable_grid) {
 				const float GRID_STEP = 64.0f;
 				for (float x = fmodf(data->scrolling[0], GRID_STEP); x < canvas_sz.x; x += GRID_STEP)
@@ -171,15 +454,28 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					draw_list->AddLine(ImVec2(canvas_p0.x, canvas_p0.y + y), ImVec2(canvas_p1.x, canvas_p0.y + y), IM_COL32(200, 200, 200, 40));
 			}
 
+			// ߣΧڻĲ
+			w->RunEntityJob([&](const CurveKnots* knots, const CurveTessellation* tess) {
+				if (tess->version != knots->version || tess->hi[0] < data->viewMin[0] || tess->lo[0] > data->viewMax[0] || tess->hi[1] < data->viewMin[1] || tess->lo[1] > data->viewMax[1])
+					return;
+				for (const auto& polyline : tess->polylines) {
+					curvePolyline.resize(polyline.size());
+					for (int n = 0; n < polyline.size(); ++n)
+						curvePolyline[n] = ImVec2(polyline[n][0] + origin.x, polyline[n][1] + origin.y);
+					lod.AddPolyline(draw_list, curvePolyline.data(), curvePolyline.size(), IM_COL32(0, 160, 0, 255), false, 1.0f);
+				}
+			}, false);
+
 			// ݵ
 			if (true) {
-				ImVec2 ps[MAX_PLOT_NUM_POINTS];
+				// Զڹ̶С飬 subdiv_ps
+				subdiv_ps.resize(data->points.size());
 				for (int n = 0; n < data->points.size(); ++n) {
 					draw_list->AddCircleFilled(ImVec2(origin.x + data->points[n][0], origin.y + data->points[n][1]), 4, IM_COL32(255, 255, 255, 255));
-					ps[n] = ImVec2(data->points[n] + origin);
+					subdiv_ps[n] = ImVec2(data->points[n] + origin);
 				}
 				if (originPoints) {
-					draw_list->AddPolyline(ps, data->points.size(), IM_COL32(0, 255, 0, 255), false, 2.0f);
+					lod.AddPolyline(draw_list, subdiv_ps.data(), data->points.size(), IM_COL32(0, 255, 0, 255), false, 2.0f);
 				}
 			}
 
@@ -191,45 +487,74 @@ void CanvasSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			if (data->points.size() > 3) {
 				// 
 				if (chaikin) {
-					ImVec2 subdiv_ps_chaikin[MAX_PLOT_NUM_POINTS];
-					std::vector<Ubpa::pointf2> subdivP_chaikin = data->points;
-					for (int st = 0; st < step_num; ++st) {
-						subdivP_chaikin = Subdivision::Chaikin_subdivision(&subdivP_chaikin, closed);
-					}
+					const std::vector<Ubpa::pointf2>& subdivP_chaikin = subdivide(Subdivision::Scheme::Chaikin, chaikinPyramid, data->points);
+					subdiv_ps.resize(subdivP_chaikin.size());
 					for (int n = 0; n < subdivP_chaikin.size(); ++n) {
-						subdiv_ps_chaikin[n] = ImVec2(subdivP_chaikin[n] + origin);
+						subdiv_ps[n] = ImVec2(subdivP_chaikin[n] + origin);
 					}
-					draw_list->AddPolyline(subdiv_ps_chaikin, subdivP_chaikin.size(), IM_COL32(0, 255, 255, 255), closed, 1.0f);
+					lod.AddPolyline(draw_list, subdiv_ps.data(), subdivP_chaikin.size(), IM_COL32(0, 255, 255, 255), closed, 1.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (cubic + quad_) * 20), IM_COL32(255, 255, 255, 255), "Chaikin");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (cubic + quad_) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (cubic + quad_) * 20), IM_COL32(0, 255, 255, 255), 2.0f);
 				}
 				if (cubic) {
-					ImVec2 subdiv_ps_cubic[MAX_PLOT_NUM_POINTS];
-					std::vector<Ubpa::pointf2> subdivP_cubic = data->points;
-					for (int st = 0; st < step_num; ++st) {
-						subdivP_cubic = Subdivision::cubic_subdivision(&subdivP_cubic, closed);
-					}
+					const std::vector<Ubpa::pointf2>& subdivP_cubic = subdivide(Subdivision::Scheme::Cubic, cubicPyramid, data->points);
+					subdiv_ps.resize(subdivP_cubic.size());
 					for (int n = 0; n < subdivP_cubic.size(); ++n) {
-						subdiv_ps_cubic[n] = ImVec2(subdivP_cubic[n] + origin);
+						subdiv_ps[n] = ImVec2(subdivP_cubic[n] + origin);
 					}
-					draw_list->AddPolyline(subdiv_ps_cubic, subdivP_cubic.size(), IM_COL32(255, 0, 255, 255), closed, 1.0f);
+					lod.AddPolyline(draw_list, subdiv_ps.data(), subdivP_cubic.size(), IM_COL32(255, 0, 255, 255), closed, 1.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (quad_) * 20), IM_COL32(255, 255, 255, 255), "cubic");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (quad_) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (quad_) * 20), IM_COL32(255, 0, 255, 255), 2.0f);
 				}
 				if (quad_)
 				{
-					ImVec2 subdiv_ps_quad[MAX_PLOT_NUM_POINTS];
-					std::vector<Ubpa::pointf2> subdivP_quad = data->points;
-					for (int st = 0; st < step_num; ++st) {
-						subdivP_quad = Subdivision::quad_subdivision(&subdivP_quad, closed, 1.0f / alpha);
-					}
+					const std::vector<Ubpa::pointf2>& subdivP_quad = subdivide(Subdivision::Scheme::Quad, quadPyramid, data->points);
+					subdiv_ps.resize(subdivP_quad.size());
 					for (int n = 0; n < subdivP_quad.size(); ++n) {
-						subdiv_ps_quad[n] = ImVec2(subdivP_quad[n] + origin);
+						subdiv_ps[n] = ImVec2(subdivP_quad[n] + origin);
 					}
-					draw_list->AddPolyline(subdiv_ps_quad, subdivP_quad.size(), IM_COL32(255, 255, 0, 255), closed, 1.0f);
+					lod.AddPolyline(draw_list, subdiv_ps.data(), subdivP_quad.size(), IM_COL32(255, 255, 0, 255), closed, 1.0f);
 					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 ), IM_COL32(255, 255, 255, 255), "quad");
 					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13), IM_COL32(255, 255, 0, 255), 2.0f);
 				}
+				if (sixPoint) {
+					const std::vector<Ubpa::pointf2>& subdivP_six = sixPointEngine.Run(data->points, step_num, closed, numThreads());
+					subdiv_ps.resize(subdivP_six.size());
+					for (int n = 0; n < subdivP_six.size(); ++n) {
+						subdiv_ps[n] = ImVec2(subdivP_six[n] + origin);
+					}
+					lod.AddPolyline(draw_list, subdiv_ps.data(), subdivP_six.size(), IM_COL32(255, 128, 0, 255), closed, 1.0f);
+					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (chaikin + cubic + quad_) * 20), IM_COL32(255, 255, 255, 255), "6-point");
+					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (chaikin + cubic + quad_) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (chaikin + cubic + quad_) * 20), IM_COL32(255, 128, 0, 255), 2.0f);
+				}
+				if (ternary) {
+					// ϸÿ 3ȡ 2/3 ʹϸ൱
+					const std::vector<Ubpa::pointf2>& subdivP_ternary = ternaryEngine.Run(data->points, (2 * step_num + 1) / 3, closed, numThreads());
+					subdiv_ps.resize(subdivP_ternary.size());
+					for (int n = 0; n < subdivP_ternary.size(); ++n) {
+						subdiv_ps[n] = ImVec2(subdivP_ternary[n] + origin);
+					}
+					lod.AddPolyline(draw_list, subdiv_ps.data(), subdivP_ternary.size(), IM_COL32(128, 255, 128, 255), closed, 1.0f);
+					draw_list->AddText(ImVec2(canvas_p1.x - 120, canvas_p1.y - 20 - (chaikin + cubic + quad_ + sixPoint) * 20), IM_COL32(255, 255, 255, 255), "ternary");
+					draw_list->AddLine(ImVec2(canvas_p1.x - 175, canvas_p1.y - 13 - (chaikin + cubic + quad_ + sixPoint) * 20), ImVec2(canvas_p1.x - 125, canvas_p1.y - 13 - (chaikin + cubic + quad_ + sixPoint) * 20), IM_COL32(128, 255, 128, 255), 2.0f);
+				}
+			}
+			// ֱʣֲֻǰ multiresLevel ϸؽ
+			if (multires) {
+				bool changed = data->points.size() != multiresInput.size() || closed != multiresClosed
+					|| std::memcmp(data->points.data(), multiresInput.data(), data->points.size() * sizeof(Ubpa::pointf2)) != 0;
+				if (changed) {
+					multiresInput = data->points;
+					multiresClosed = closed;
+					multiresCurve.Decompose(Subdivision::Scheme::Chaikin, multiresInput, closed, MULTIRES_MAX_LEVELS);
+				}
+				multiresLevel = std::min(multiresLevel, multiresCurve.Levels());
+				const std::vector<Ubpa::pointf2>& multiresP = multiresCurve.Reconstruct(multiresLevel);
+				subdiv_ps.resize(multiresP.size());
+				for (int n = 0; n < multiresP.size(); ++n) {
+					subdiv_ps[n] = ImVec2(multiresP[n] + origin);
+				}
+				lod.AddPolyline(draw_list, subdiv_ps.data(), multiresP.size(), IM_COL32(200, 200, 255, 255), closed, 1.5f);
 			}
 			draw_list->PopClipRect();
 		}
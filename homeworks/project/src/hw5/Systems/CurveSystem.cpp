@@ -0,0 +1,59 @@
+#include "CurveSystem.h"
+
+#include "../Components/CurveData.h"
+#include "../Subdivision/SubdivisionEngine.h"
+#include "../Subdivision/SubdivisionStencil.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace Ubpa;
+
+void CurveSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
+	schedule.RegisterCommand([](Ubpa::UECS::World* w) {
+		Subdivision::Engine engine;
+		Subdivision::StencilEngine<Subdivision::SixPointStencil> sixPointEngine;
+		Subdivision::StencilEngine<Subdivision::TernaryStencil> ternaryEngine;
+
+		// ֻδϸֵߡֵ͸ʽڿƶε͹ڣϸǰòΧУ
+		// Բ޳ʵ岻޸ģÿֻϸһΡϸĻ干ãд
+		w->RunEntityJob([&](const CurveKnots* knots, CurveTessellation* tess) {
+			if (tess->version == knots->version)
+				return;
+			const std::vector<Ubpa::pointf2>& points = knots->points;
+			auto add = [&](const std::vector<Ubpa::pointf2>& polyline) {
+				tess->polylines.push_back(polyline);
+				if (knots->closed && polyline.size() > 2)
+					tess->polylines.back().push_back(polyline.front());
+			};
+
+			tess->polylines.clear();
+			if (points.size() > 3) {
+				if (knots->chaikin)
+					add(engine.Run(Subdivision::Scheme::Chaikin, points, knots->step_num, knots->closed));
+				if (knots->cubic)
+					add(engine.Run(Subdivision::Scheme::Cubic, points, knots->step_num, knots->closed));
+				if (knots->quad)
+					add(engine.Run(Subdivision::Scheme::Quad, points, knots->step_num, knots->closed, 1.0f / knots->alpha));
+				if (knots->sixPoint)
+					add(sixPointEngine.Run(points, knots->step_num, knots->closed));
+				// 뻭ͬϸֵĲȡ 2/3
+				if (knots->ternary)
+					add(ternaryEngine.Run(points, (2 * knots->step_num + 1) / 3, knots->closed));
+			}
+			// ûϸֽʱƶΣԿɼѡȡ
+			if (tess->polylines.empty())
+				add(points);
+
+			tess->lo = Ubpa::pointf2(FLT_MAX, FLT_MAX);
+			tess->hi = Ubpa::pointf2(-FLT_MAX, -FLT_MAX);
+			for (const auto& polyline : tess->polylines) {
+				for (const auto& p : polyline) {
+					tess->lo = Ubpa::pointf2(std::min(tess->lo[0], p[0]), std::min(tess->lo[1], p[1]));
+					tess->hi = Ubpa::pointf2(std::max(tess->hi[0], p[0]), std::max(tess->hi[1], p[1]));
+				}
+			}
+			tess->version = knots->version;
+		}, false);
+	});
+}
@@ -17,6 +17,65 @@ struct DenoiseData {
 	[[UInspector::tooltip("random scale")]]
 	float randomScale = 1.f;
 
+	[[UInspector::min_value(0)]]
+	[[UInspector::tooltip("noise: 0 uniform in [-scale, scale], 1 gaussian with deviation scale, 2 gaussian along vertex normals")]]
+	int noiseType = 0;
+
+	[[UInspector::tooltip("noise: same seed, same noise for every thread count")]]
+	int noiseSeed = 0;
+
+	[[UInspector::tooltip("load OBJ: read the half-edge structure from '<file>.hemesh' when it matches the file, otherwise write it")]]
+	bool objTopologyCache = true;
+
+	[[UInspector::tooltip("minimal surface: cotangent weights instead of uniform weights")]]
+	bool cotangentWeights = false;
+
+	[[UInspector::min_value(1)]]
+	[[UInspector::tooltip("minimal surface: cotangent weights are recomputed from the surface this many times")]]
+	int minSurfRounds = 3;
+
+	[[UInspector::min_value(1)]]
+	[[UInspector::tooltip("minimal surface: maximum number of iterations")]]
+	int minSurfIterations = 1000;
+
+	[[UInspector::min_value(0.f)]]
+	[[UInspector::tooltip("minimal surface: stop when max displacement / bounding box diagonal is below it")]]
+	float minSurfTolerance = 1e-5f;
+
+	[[UInspector::tooltip("global minimal surface: preconditioned CG instead of sparse LDLT (CG is used anyway for very large meshes)")]]
+	bool minSurfCG = false;
+
+	[[UInspector::tooltip("bilateral denoise: faces sharing a vertex are neighbors, otherwise only faces sharing an edge")]]
+	bool denoiseVertexRing = true;
+
+	[[UInspector::min_value(0)]]
+	[[UInspector::tooltip("bilateral denoise: number of face normal filtering iterations")]]
+	int denoiseNormalIterations = 10;
+
+	[[UInspector::min_value(0)]]
+	[[UInspector::tooltip("bilateral denoise: number of vertex update iterations")]]
+	int denoiseVertexIterations = 10;
+
+	[[UInspector::min_value(0.f)]]
+	[[UInspector::tooltip("bilateral denoise: spatial sigma, in units of the mean distance between adjacent face centroids")]]
+	float denoiseSigmaSpatial = 1.f;
+
+	[[UInspector::min_value(0.f)]]
+	[[UInspector::tooltip("bilateral denoise: sigma of the normal difference")]]
+	float denoiseSigmaNormal = 0.35f;
+
+	[[UInspector::min_value(0.f)]]
+	[[UInspector::tooltip("mean curvature flow: step size, in units of the mean vertex area")]]
+	float mcfStepSize = 10.f;
+
+	[[UInspector::min_value(1)]]
+	[[UInspector::tooltip("mean curvature flow: number of implicit steps")]]
+	int mcfSteps = 3;
+
+	[[UInspector::min_value(0.f)]]
+	[[UInspector::tooltip("mean curvature flow: the factorization is reused while the matrix changes less than this relative to its diagonal")]]
+	float mcfLagTolerance = 0.05f;
+
 	std::shared_ptr<Ubpa::Utopia::Mesh> mesh;
 
 	[[UInspector::hide]]
@@ -18,6 +18,81 @@ struct Ubpa::USRefl::TypeInfo<DenoiseData> :
             Attr {TSTR(UInspector::min_value), 0.f},
             Attr {TSTR(UInspector::tooltip), "random scale"},
         }},
+        Field {TSTR("noiseType"), &Type::noiseType, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 0; }},
+            Attr {TSTR(UInspector::min_value), 0},
+            Attr {TSTR(UInspector::tooltip), "noise: 0 uniform in [-scale, scale], 1 gaussian with deviation scale, 2 gaussian along vertex normals"},
+        }},
+        Field {TSTR("noiseSeed"), &Type::noiseSeed, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 0; }},
+            Attr {TSTR(UInspector::tooltip), "noise: same seed, same noise for every thread count"},
+        }},
+        Field {TSTR("objTopologyCache"), &Type::objTopologyCache, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return true; }},
+            Attr {TSTR(UInspector::tooltip), "load OBJ: read the half-edge structure from '<file>.hemesh' when it matches the file, otherwise write it"},
+        }},
+        Field {TSTR("cotangentWeights"), &Type::cotangentWeights, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return false; }},
+            Attr {TSTR(UInspector::tooltip), "minimal surface: cotangent weights instead of uniform weights"},
+        }},
+        Field {TSTR("minSurfRounds"), &Type::minSurfRounds, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 3; }},
+            Attr {TSTR(UInspector::min_value), 1},
+            Attr {TSTR(UInspector::tooltip), "minimal surface: cotangent weights are recomputed from the surface this many times"},
+        }},
+        Field {TSTR("minSurfIterations"), &Type::minSurfIterations, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 1000; }},
+            Attr {TSTR(UInspector::min_value), 1},
+            Attr {TSTR(UInspector::tooltip), "minimal surface: maximum number of iterations"},
+        }},
+        Field {TSTR("minSurfTolerance"), &Type::minSurfTolerance, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->float{ return 1e-5f; }},
+            Attr {TSTR(UInspector::min_value), 0.f},
+            Attr {TSTR(UInspector::tooltip), "minimal surface: stop when max displacement / bounding box diagonal is below it"},
+        }},
+        Field {TSTR("minSurfCG"), &Type::minSurfCG, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return false; }},
+            Attr {TSTR(UInspector::tooltip), "global minimal surface: preconditioned CG instead of sparse LDLT (CG is used anyway for very large meshes)"},
+        }},
+        Field {TSTR("denoiseVertexRing"), &Type::denoiseVertexRing, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->bool{ return true; }},
+            Attr {TSTR(UInspector::tooltip), "bilateral denoise: faces sharing a vertex are neighbors, otherwise only faces sharing an edge"},
+        }},
+        Field {TSTR("denoiseNormalIterations"), &Type::denoiseNormalIterations, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 10; }},
+            Attr {TSTR(UInspector::min_value), 0},
+            Attr {TSTR(UInspector::tooltip), "bilateral denoise: number of face normal filtering iterations"},
+        }},
+        Field {TSTR("denoiseVertexIterations"), &Type::denoiseVertexIterations, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 10; }},
+            Attr {TSTR(UInspector::min_value), 0},
+            Attr {TSTR(UInspector::tooltip), "bilateral denoise: number of vertex update iterations"},
+        }},
+        Field {TSTR("denoiseSigmaSpatial"), &Type::denoiseSigmaSpatial, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->float{ return 1.f; }},
+            Attr {TSTR(UInspector::min_value), 0.f},
+            Attr {TSTR(UInspector::tooltip), "bilateral denoise: spatial sigma, in units of the mean distance between adjacent face centroids"},
+        }},
+        Field {TSTR("denoiseSigmaNormal"), &Type::denoiseSigmaNormal, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->float{ return 0.35f; }},
+            Attr {TSTR(UInspector::min_value), 0.f},
+            Attr {TSTR(UInspector::tooltip), "bilateral denoise: sigma of the normal difference"},
+        }},
+        Field {TSTR("mcfStepSize"), &Type::mcfStepSize, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->float{ return 10.f; }},
+            Attr {TSTR(UInspector::min_value), 0.f},
+            Attr {TSTR(UInspector::tooltip), "mean curvature flow: step size, in units of the mean vertex area"},
+        }},
+        Field {TSTR("mcfSteps"), &Type::mcfSteps, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->int{ return 3; }},
+            Attr {TSTR(UInspector::min_value), 1},
+            Attr {TSTR(UInspector::tooltip), "mean curvature flow: number of implicit steps"},
+        }},
+        Field {TSTR("mcfLagTolerance"), &Type::mcfLagTolerance, AttrList {
+            Attr {TSTR(UMeta::initializer), []()->float{ return 0.05f; }},
+            Attr {TSTR(UInspector::min_value), 0.f},
+            Attr {TSTR(UInspector::tooltip), "mean curvature flow: the factorization is reused while the matrix changes less than this relative to its diagonal"},
+        }},
         Field {TSTR("mesh"), &Type::mesh},
         Field {TSTR("heMesh"), &Type::heMesh, AttrList {
             Attr {TSTR(UMeta::initializer), []()->std::shared_ptr<HEMeshX>{ return { std::make_shared<HEMeshX>() }; }},
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**********************************************************************************
+/// @file       BilateralDenoise.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ˫߷˲ȥ
+/// @details    Zheng et al. 2011, Bilateral Normal Filtering for Mesh Denoising
+///             1. 淨 n_i <- normalize(sum_j A_j Ws(|c_i - c_j|) Wr(|n_i - n_j|) n_j)j ȡ i 棬
+///                WsWr Ϊ˹ռ sigma ĵƽΪλ
+///             2.  x_i <- x_i + 1/|F_i| sum_{f in F_i} n_f (n_f . (c_f - x_i))ʹ˲ķһ
+///             ڹϵ򹲱ߣ CSR 洢˲ʱֻһΣÿε򶥵ֿ鲢
+**********************************************************************************/
+
+namespace Geometry {
+	struct BilateralDenoiseParams {
+		int normalIterations{ 10 };
+		int vertexIterations{ 10 };
+		float sigmaSpatial{ 1.f };	// ƽı
+		float sigmaNormal{ 0.35f };
+	};
+
+	struct BilateralDenoiseStats {
+		int faces{ 0 };
+		double setupMs{ 0.0 };		// ڹϵ
+		double geometryMs{ 0.0 };	// ʼ淨
+		double normalMs{ 0.0 };		// ˲
+		double vertexMs{ 0.0 };		// 
+	};
+
+	class BilateralDenoise {
+	public:
+		/*
+		/// @brief      ±ڹϵ
+		/// @details    ĲУε f ߣһεֻ
+		/// @param[in]  : vertexRing : true ʱ涼ڣֻȡߵ
+		/// @return
+		/// @attention  ˸ıҪµãɱȽ TopologyVersion ж
+		*/
+		void Init(HEMeshX& mesh, bool vertexRing, int numThreads = 1) {
+			assert(mesh.AttributesInSync());
+			auto t0 = std::chrono::high_resolution_clock::now();
+			this->vertexRing = vertexRing;
+			topologyVersion = mesh.TopologyVersion();
+			const int n = static_cast<int>(mesh.Vertices().size());
+			const int m = static_cast<int>(mesh.Polygons().size());
+			indices.resize(3 * static_cast<size_t>(m));
+			parallelFor(m, numThreads, [&](int f) {
+				auto* he = mesh.Polygons().at(f)->HalfEdge();
+				for (int k = 0; k < 3; ++k) {
+					indices[3 * f + k] = he->Origin()->index;
+					he = he->Next();
+				}
+			});
+
+			vertexOffsets.assign(n + 1, 0);
+			for (int v : indices)
+				++vertexOffsets[v + 1];
+			for (int i = 0; i < n; ++i)
+				vertexOffsets[i + 1] += vertexOffsets[i];
+			vertexFaces.resize(indices.size());
+			std::vector<int> cursor(vertexOffsets.begin(), vertexOffsets.end() - 1);
+			for (int h = 0; h < 3 * m; ++h)
+				vertexFaces[cursor[indices[h]]++] = h / 3;
+
+			// ռ棬󰴿˳ƴ
+			const int chunks = chunkCount(m, numThreads);
+			std::vector<std::vector<int>> chunkNeighbors(chunks);
+			faceOffsets.assign(m + 1, 0);
+			parallelChunks(m, numThreads, [&](int chunk, int begin, int end) {
+				std::vector<int> around;
+				for (int f = begin; f < end; ++f) {
+					around.clear();
+					for (int k = 0; k < 3; ++k) {
+						const int v = indices[3 * f + k];
+						around.insert(around.end(), vertexFaces.begin() + vertexOffsets[v], vertexFaces.begin() + vertexOffsets[v + 1]);
+					}
+					std::sort(around.begin(), around.end());
+					for (size_t i = 0; i < around.size();) {
+						size_t j = i + 1;
+						while (j < around.size() && around[j] == around[i])
+							++j;
+						if (around[i] != f && (vertexRing || j - i >= 2))
+							chunkNeighbors[chunk].push_back(around[i]);
+						i = j;
+					}
+					faceOffsets[f + 1] = static_cast<int>(chunkNeighbors[chunk].size());
+				}
+			});
+			faceNeighbors.clear();
+			for (int c = 0, f = 0; c < chunks; ++c) {
+				const int base = static_cast<int>(faceNeighbors.size());
+				const int end = static_cast<int>(static_cast<long long>(m) * (c + 1) / chunks);
+				for (; f < end; ++f)
+					faceOffsets[f + 1] += base;
+				faceNeighbors.insert(faceNeighbors.end(), chunkNeighbors[c].begin(), chunkNeighbors[c].end());
+			}
+
+			normals.resize(m);
+			filtered.resize(m);
+			centroids.resize(m);
+			areas.resize(m);
+			stats = BilateralDenoiseStats();
+			stats.faces = m;
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.setupMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+		}
+
+		/*
+		/// @brief      ˲淨򲢸 mesh.positions
+		/// @details
+		/// @param[in]  :
+		/// @return     ͳϢ
+		/// @attention   Init
+		*/
+		const BilateralDenoiseStats& Run(HEMeshX& mesh, const BilateralDenoiseParams& params, int numThreads = 1) {
+			const int m = static_cast<int>(normals.size());
+			const int n = static_cast<int>(vertexOffsets.size()) - 1;
+			std::vector<Ubpa::pointf3>& x = mesh.positions;
+
+			auto t0 = std::chrono::high_resolution_clock::now();
+			UpdateGeometry(x, numThreads);
+			// ռ sigma ĵλľƽ
+			std::vector<double> chunkSum(chunkCount(m, numThreads), 0.0);
+			parallelChunks(m, numThreads, [&](int chunk, int begin, int end) {
+				double sum = 0.0;
+				for (int f = begin; f < end; ++f) {
+					for (int e = faceOffsets[f]; e < faceOffsets[f + 1]; ++e)
+						sum += distance(centroids[f], centroids[faceNeighbors[e]]);
+				}
+				chunkSum[chunk] = sum;
+			});
+			double total = 0.0;
+			for (double sum : chunkSum)
+				total += sum;
+			const float meanDistance = faceNeighbors.empty() ? 1.f : static_cast<float>(total / faceNeighbors.size());
+			const float sigmaSpatial = std::max(params.sigmaSpatial * meanDistance, 1e-20f);
+			const float sigmaNormal = std::max(params.sigmaNormal, 1e-20f);
+			const float spatial = -0.5f / (sigmaSpatial * sigmaSpatial);
+			const float range = -0.5f / (sigmaNormal * sigmaNormal);
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.geometryMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+			for (int it = 0; it < params.normalIterations; ++it) {
+				parallelFor(m, numThreads, [&](int f) {
+					const Ubpa::vecf3& ni = normals[f];
+					float sx = areas[f] * ni[0], sy = areas[f] * ni[1], sz = areas[f] * ni[2];
+					for (int e = faceOffsets[f]; e < faceOffsets[f + 1]; ++e) {
+						const int g = faceNeighbors[e];
+						const Ubpa::vecf3& nj = normals[g];
+						const float dx = ni[0] - nj[0], dy = ni[1] - nj[1], dz = ni[2] - nj[2];
+						const float d2 = distance2(centroids[f], centroids[g]);
+						const float w = areas[g] * expf(spatial * d2 + range * (dx * dx + dy * dy + dz * dz));
+						sx += w * nj[0];
+						sy += w * nj[1];
+						sz += w * nj[2];
+					}
+					const float len = sqrtf(sx * sx + sy * sy + sz * sz);
+					filtered[f] = len > 0.f ? Ubpa::vecf3(sx / len, sy / len, sz / len) : ni;
+				});
+				normals.swap(filtered);
+			}
+			auto t2 = std::chrono::high_resolution_clock::now();
+			stats.normalMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+			std::vector<Ubpa::pointf3> next(n);
+			for (int it = 0; it < params.vertexIterations; ++it) {
+				if (it > 0)
+					UpdateCentroids(x, numThreads);
+				parallelFor(n, numThreads, [&](int i) {
+					const int count = vertexOffsets[i + 1] - vertexOffsets[i];
+					if (count == 0) {
+						next[i] = x[i];
+						return;
+					}
+					float dx = 0.f, dy = 0.f, dz = 0.f;
+					for (int e = vertexOffsets[i]; e < vertexOffsets[i + 1]; ++e) {
+						const int f = vertexFaces[e];
+						const Ubpa::vecf3& nf = normals[f];
+						const float t = nf[0] * (centroids[f][0] - x[i][0]) + nf[1] * (centroids[f][1] - x[i][1]) + nf[2] * (centroids[f][2] - x[i][2]);
+						dx += t * nf[0];
+						dy += t * nf[1];
+						dz += t * nf[2];
+					}
+					next[i] = Ubpa::pointf3(x[i][0] + dx / count, x[i][1] + dy / count, x[i][2] + dz / count);
+				});
+				x.swap(next);
+			}
+			auto t3 = std::chrono::high_resolution_clock::now();
+			stats.vertexMs = std::chrono::duration<double, std::milli>(t3 - t2).count();
+			return stats;
+		}
+
+		size_t TopologyVersion() const { return topologyVersion; }
+
+		bool IsVertexRing() const { return vertexRing; }
+
+		const BilateralDenoiseStats& Stats() const { return stats; }
+
+	private:
+		static float distance2(const Ubpa::pointf3& a, const Ubpa::pointf3& b) {
+			const float dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+			return dx * dx + dy * dy + dz * dz;
+		}
+
+		static float distance(const Ubpa::pointf3& a, const Ubpa::pointf3& b) { return sqrtf(distance2(a, b)); }
+
+		// 淨
+		void UpdateGeometry(const std::vector<Ubpa::pointf3>& x, int numThreads) {
+			parallelFor(static_cast<int>(normals.size()), numThreads, [&](int f) {
+				const Ubpa::pointf3& a = x[indices[3 * f]];
+				const Ubpa::pointf3& b = x[indices[3 * f + 1]];
+				const Ubpa::pointf3& c = x[indices[3 * f + 2]];
+				const float ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+				const float vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+				const float nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+				const float len = sqrtf(nx * nx + ny * ny + nz * nz);
+				normals[f] = len > 0.f ? Ubpa::vecf3(nx / len, ny / len, nz / len) : Ubpa::vecf3(0.f, 0.f, 0.f);
+				areas[f] = 0.5f * len;
+				centroids[f] = Ubpa::pointf3((a[0] + b[0] + c[0]) / 3.f, (a[1] + b[1] + c[1]) / 3.f, (a[2] + b[2] + c[2]) / 3.f);
+			});
+		}
+
+		void UpdateCentroids(const std::vector<Ubpa::pointf3>& x, int numThreads) {
+			parallelFor(static_cast<int>(centroids.size()), numThreads, [&](int f) {
+				const Ubpa::pointf3& a = x[indices[3 * f]];
+				const Ubpa::pointf3& b = x[indices[3 * f + 1]];
+				const Ubpa::pointf3& c = x[indices[3 * f + 2]];
+				centroids[f] = Ubpa::pointf3((a[0] + b[0] + c[0]) / 3.f, (a[1] + b[1] + c[1]) / 3.f, (a[2] + b[2] + c[2]) / 3.f);
+			});
+		}
+
+		bool vertexRing{ true };
+		size_t topologyVersion{ 0 };
+		std::vector<int> indices;			// ÿ
+		std::vector<int> vertexOffsets;		//  i ڵΪ vertexFaces[vertexOffsets[i], vertexOffsets[i+1])
+		std::vector<int> vertexFaces;
+		std::vector<int> faceOffsets;		//  f Ϊ faceNeighbors[faceOffsets[f], faceOffsets[f+1])
+		std::vector<int> faceNeighbors;
+		std::vector<Ubpa::vecf3> normals, filtered;	// ˲
+		std::vector<Ubpa::pointf3> centroids;
+		std::vector<float> areas;
+		BilateralDenoiseStats stats;
+	};
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "Topology.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**********************************************************************************
+/// @file       HEMeshBuilder.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ±ٽ HEMeshX
+/// @details     buildTopology ±μ飨ɲУٰ֪һԪأ
+///             ÿֻ AddEdge һΣߵ next 붥ĳֱӰ±ṹд룬
+///             AddPolygon ʱѾڣٲ HalfEdgeTo аߣλ鿽 mesh.positions
+**********************************************************************************/
+
+namespace Geometry {
+	struct HEMeshBuildStats {
+		int vertices{ 0 };
+		int faces{ 0 };
+		int boundaryHalfEdges{ 0 };
+		double topologyMs{ 0.0 };	// 
+		double elementsMs{ 0.0 };	//  HEMesh Ԫλ
+	};
+
+	/*
+	/// @brief      ±ṹ HEMeshX Ԫ
+	/// @details    㡢ߡ˳ topo е±һ£ mesh.Vertices().at(i) Ӧ positions[i]
+	/// @param[in]  : positions :  topo.numVertices һ
+	/// @return     AddPolygon ʧʱ falseʱ mesh ѱ
+	/// @attention  Ԫصڴ HEMesh ֻܴ
+	*/
+	inline bool fillHEMesh(const Topology& topo, const Ubpa::pointf3* positions, HEMeshX& mesh) {
+		mesh.Clear();
+		mesh.Reserve(topo.numVertices);
+		std::vector<Vertex*> vertices(topo.numVertices);
+		for (int i = 0; i < topo.numVertices; ++i)
+			vertices[i] = mesh.AddVertex();
+		std::copy(positions, positions + topo.numVertices, mesh.positions.begin());
+
+		// ߽ߵ±ܴԵΰߣÿɽСһ
+		const int numHalfEdges = topo.NumHalfEdges();
+		std::vector<HalfEdge*> halfEdges(numHalfEdges);
+		for (int h = 0; h < numHalfEdges; ++h) {
+			const int p = topo.pair[h];
+			if (h > p)
+				continue;
+			Vertex* v = vertices[topo.origin[h]];
+			HalfEdge* he = mesh.AddEdge(v, vertices[topo.origin[p]])->HalfEdge();
+			if (he->Origin() != v)
+				he = he->Pair();
+			halfEdges[h] = he;
+			halfEdges[p] = he->Pair();
+		}
+		for (int h = 0; h < numHalfEdges; ++h)
+			halfEdges[h]->SetNext(halfEdges[topo.next[h]]);
+
+		std::vector<HalfEdge*> loop(3);
+		for (int f = 0; f < topo.numFaces; ++f) {
+			loop[0] = halfEdges[3 * f];
+			loop[1] = halfEdges[3 * f + 1];
+			loop[2] = halfEdges[3 * f + 2];
+			if (!mesh.AddPolygon(loop)) {
+				mesh.Clear();
+				return false;
+			}
+		}
+		for (int i = 0; i < topo.numVertices; ++i) {
+			if (topo.vertexHalfEdge[i] >= 0)
+				vertices[i]->SetHalfEdge(halfEdges[topo.vertexHalfEdge[i]]);
+		}
+		return true;
+	}
+
+	/*
+	/// @brief      ±붥λý HEMeshX
+	/// @details    ȡ positions ĴСδõĶΪ
+	/// @param[in]  : topo : ǿʱ±ṹ֮㷨
+	/// @return     ʧԭʧʱ mesh Ϊ
+	/// @attention
+	*/
+	inline TopologyError buildHEMesh(const std::vector<uint32_t>& indices, const std::vector<Ubpa::pointf3>& positions, HEMeshX& mesh,
+		int numThreads = 1, HEMeshBuildStats* stats = nullptr, Topology* topo = nullptr)
+	{
+		auto t0 = std::chrono::high_resolution_clock::now();
+		Topology local;
+		Topology& t = topo ? *topo : local;
+		const int numFaces = static_cast<int>(indices.size() / 3);
+		TopologyError error = buildTopology(indices.data(), numFaces, static_cast<int>(positions.size()), &t, numThreads);
+		auto t1 = std::chrono::high_resolution_clock::now();
+		if (error == TopologyError::None && !fillHEMesh(t, positions.data(), mesh))
+			error = TopologyError::NonManifoldVertex;
+		if (error != TopologyError::None)
+			mesh.Clear();
+		auto t2 = std::chrono::high_resolution_clock::now();
+		if (stats) {
+			stats->vertices = t.numVertices;
+			stats->faces = t.numFaces;
+			stats->boundaryHalfEdges = t.NumHalfEdges() - t.NumInteriorHalfEdges();
+			stats->topologyMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+			stats->elementsMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+		}
+		return error;
+	}
+}
@@ -0,0 +1,353 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "HEMeshBuilder.h"
+#include "MappedFile.h"
+#include "Parallel.h"
+#include "Topology.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**********************************************************************************
+/// @file       HEMeshCache.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ߽ṹĶƻ
+/// @details     Topology  nextpairoriginfacevertexHalfEdge  HEMeshX Ķԭдļ
+///             ȡʱļӳ䵽ڴ棬Уֱ±ṹԪأfillHEMesh ±Ӻָ룩
+///             Դļԣļͷ¸ʽ汾ԴݵУͣԴļ˻漴ϣ
+///             Уֹͣ𻵵ļ
+**********************************************************************************/
+
+namespace Geometry {
+	// ʽıʱһɰ汾Ļᱻܾ
+	constexpr uint32_t HEMESH_CACHE_VERSION = 1;
+	// УͰôĿֱٺϲ߳޹
+	constexpr size_t CHECKSUM_BLOCK = 1 << 20;
+
+	enum class HEMeshCacheError {
+		None,
+		OpenFailed,
+		BadHeader,			// ǻļСļͷ
+		VersionMismatch,
+		StaleSource,		// ԴݵУͲͬ
+		Corrupt,			// УͲ±ṹǺϷİ߽ṹ
+		BadTopology			// Ԫʧ
+	};
+
+	inline const char* toString(HEMeshCacheError error) {
+		switch (error) {
+		case HEMeshCacheError::None: return "none";
+		case HEMeshCacheError::OpenFailed: return "open failed";
+		case HEMeshCacheError::BadHeader: return "bad header";
+		case HEMeshCacheError::VersionMismatch: return "version mismatch";
+		case HEMeshCacheError::StaleSource: return "stale source";
+		case HEMeshCacheError::Corrupt: return "corrupt";
+		case HEMeshCacheError::BadTopology: return "bad topology";
+		default: return "unknown";
+		}
+	}
+
+	struct HEMeshCacheStats {
+		size_t bytes{ 0 };
+		int vertices{ 0 };
+		int faces{ 0 };
+		int halfEdges{ 0 };
+		double mapMs{ 0.0 };
+		double checksumMs{ 0.0 };
+		double topologyMs{ 0.0 };	// ±ṹһ
+		double elementsMs{ 0.0 };	//  HEMesh Ԫ
+	};
+
+	namespace details {
+		// ֶ 8 ֽڶ룬ļͷ֮ĸ 4 ֽڶ룬ӳֱӰͶȡ
+		struct HEMeshCacheHeader {
+			char magic[8];
+			uint32_t version;
+			uint32_t flags;			//  0 λз
+			int32_t numVertices;
+			int32_t numFaces;
+			int32_t numHalfEdges;
+			int32_t numScalars;
+			uint64_t sourceChecksum;
+			uint64_t payloadBytes;
+			uint64_t payloadChecksum;
+		};
+
+		constexpr char HEMESH_CACHE_MAGIC[8] = { 'H', 'E', 'M', 'E', 'S', 'H', 'X', '\0' };
+		constexpr uint32_t HEMESH_CACHE_NORMALS = 1u;
+
+		inline uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+		// 8 ֽһĳ˷-תϣĩβ 8 ֽڵĲֲ
+		inline uint64_t checksumBlock(const char* data, size_t bytes) {
+			constexpr uint64_t P1 = 0x9E3779B185EBCA87ull, P2 = 0xC2B2AE3D27D4EB4Full;
+			uint64_t h = P2 ^ bytes;
+			size_t i = 0;
+			for (; i + 8 <= bytes; i += 8) {
+				uint64_t w;
+				std::memcpy(&w, data + i, 8);
+				h = rotl64(h ^ (w * P1), 31) * P2;
+			}
+			if (i < bytes) {
+				uint64_t w = 0;
+				std::memcpy(&w, data + i, bytes - i);
+				h = rotl64(h ^ (w * P1), 31) * P2;
+			}
+			h ^= h >> 33;
+			h *= P1;
+			h ^= h >> 29;
+			return h;
+		}
+
+		// ΰ 4 ֽڶ
+		inline size_t alignedSize(size_t bytes) { return (bytes + 3) & ~size_t(3); }
+
+		inline size_t payloadSize(const HEMeshCacheHeader& header) {
+			const size_t v = static_cast<size_t>(header.numVertices);
+			const size_t h = static_cast<size_t>(header.numHalfEdges);
+			size_t bytes = 4 * h * sizeof(int32_t) + v * sizeof(int32_t) + 3 * v * sizeof(float);
+			if (header.flags & HEMESH_CACHE_NORMALS)
+				bytes += 3 * v * sizeof(float);
+			return bytes;	// ԵĴСйأȡʱۼ
+		}
+	}
+
+	/*
+	/// @brief      64 λУ
+	/// @details     CHECKSUM_BLOCK ֿ鲢м㣬ٰ˳ϲ
+	/// @param[in]  :
+	/// @return
+	/// @attention  ڷֹ𻵵Ļ棬Ǽܹϣ
+	*/
+	inline uint64_t checksum64(const void* data, size_t bytes, int numThreads = 1) {
+		const char* p = static_cast<const char*>(data);
+		const size_t blocks = (bytes + CHECKSUM_BLOCK - 1) / CHECKSUM_BLOCK;
+		std::vector<uint64_t> blockSums(blocks);
+		const int tasks = static_cast<int>(std::max<size_t>(1, std::min<size_t>(numThreads, blocks)));
+		parallelTasks(tasks, [&](int task) {
+			for (size_t b = blocks * task / tasks; b < blocks * (task + 1) / tasks; ++b)
+				blockSums[b] = details::checksumBlock(p + b * CHECKSUM_BLOCK, std::min(CHECKSUM_BLOCK, bytes - b * CHECKSUM_BLOCK));
+		});
+		return details::checksumBlock(reinterpret_cast<const char*>(blockSums.data()), blockSums.size() * sizeof(uint64_t)) ^ bytes;
+	}
+
+	// ļУͣԴУ
+	inline bool checksumFile(const std::string& path, uint64_t* checksum, int numThreads = 1) {
+		MappedFile file;
+		if (!file.Open(path))
+			return false;
+		*checksum = checksum64(file.Data(), file.Size(), numThreads);
+		return true;
+	}
+
+	/*
+	/// @brief      ±ṹ붥д뻺ļ
+	/// @details    д path.tmp ٸдһʧܲ°
+	/// @param[in]  : topo :  mesh ʱ±ṹbuildHEMesh  i  mesh ĵ i 
+	/// @param[in]  : sourceChecksum : ԴݵУͣȡʱֵͬ
+	/// @return     дʧܻ mesh  topo Ӧʱ false
+	/// @attention
+	*/
+	inline bool saveHEMeshCache(const std::string& path, const Topology& topo, HEMeshX& mesh, uint64_t sourceChecksum, int numThreads = 1) {
+		using namespace details;
+		const int n = topo.numVertices;
+		if (static_cast<int>(mesh.positions.size()) != n || static_cast<int>(mesh.Polygons().size()) != topo.numFaces)
+			return false;
+
+		HEMeshCacheHeader header{};
+		std::memcpy(header.magic, HEMESH_CACHE_MAGIC, sizeof(header.magic));
+		header.version = HEMESH_CACHE_VERSION;
+		header.flags = static_cast<int>(mesh.normals.size()) == n ? HEMESH_CACHE_NORMALS : 0u;
+		header.numVertices = n;
+		header.numFaces = topo.numFaces;
+		header.numHalfEdges = topo.NumHalfEdges();
+		header.sourceChecksum = sourceChecksum;
+
+		// ԰ͬдͬļ
+		std::vector<const std::string*> names;
+		for (const auto& [name, values] : mesh.scalars) {
+			if (static_cast<int>(values.size()) == n)
+				names.push_back(&name);
+		}
+		std::sort(names.begin(), names.end(), [](const std::string* a, const std::string* b) { return *a < *b; });
+		header.numScalars = static_cast<int32_t>(names.size());
+
+		std::vector<char> payload;
+		size_t bytes = payloadSize(header);
+		for (const std::string* name : names)
+			bytes += sizeof(uint32_t) + alignedSize(name->size()) + n * sizeof(float);
+		payload.reserve(bytes);
+		auto append = [&](const void* data, size_t size) {
+			const char* p = static_cast<const char*>(data);
+			payload.insert(payload.end(), p, p + size);
+			payload.resize(alignedSize(payload.size()), 0);
+		};
+		append(topo.next.data(), topo.next.size() * sizeof(int32_t));
+		append(topo.pair.data(), topo.pair.size() * sizeof(int32_t));
+		append(topo.origin.data(), topo.origin.size() * sizeof(int32_t));
+		append(topo.face.data(), topo.face.size() * sizeof(int32_t));
+		append(topo.vertexHalfEdge.data(), topo.vertexHalfEdge.size() * sizeof(int32_t));
+		append(mesh.positions.data(), mesh.positions.size() * sizeof(Ubpa::pointf3));
+		if (header.flags & HEMESH_CACHE_NORMALS)
+			append(mesh.normals.data(), mesh.normals.size() * sizeof(Ubpa::normalf));
+		for (const std::string* name : names) {
+			const uint32_t length = static_cast<uint32_t>(name->size());
+			append(&length, sizeof(length));
+			append(name->data(), name->size());
+			append(mesh.scalars.at(*name).data(), n * sizeof(float));
+		}
+		header.payloadBytes = payload.size();
+		header.payloadChecksum = checksum64(payload.data(), payload.size(), numThreads);
+
+		const std::string tmp = path + ".tmp";
+		{
+			std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+			if (!out)
+				return false;
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+			if (!out)
+				return false;
+		}
+		std::error_code ec;
+		std::filesystem::rename(tmp, path, ec);
+		if (ec) {
+			std::filesystem::remove(tmp, ec);
+			return false;
+		}
+		return true;
+	}
+
+	/*
+	/// @brief      ɻļ HEMeshX
+	/// @details    μļͷ汾ԴУ͡У±ṹһԣͨ fillHEMesh
+	///             λֱӴӳڴ濽룬
+	/// @param[in]  : sourceChecksum : дʱͬʹû
+	/// @param[in]  : topo : ǿʱ±ṹ
+	/// @return     ʧԭʧʱ mesh 䣨BadTopology ʱΪգ
+	/// @attention
+	*/
+	inline HEMeshCacheError loadHEMeshCache(const std::string& path, uint64_t sourceChecksum, HEMeshX& mesh,
+		int numThreads = 1, Topology* topo = nullptr, HEMeshCacheStats* stats = nullptr)
+	{
+		using namespace details;
+		HEMeshCacheStats localStats;
+		if (!stats)
+			stats = &localStats;
+		*stats = HEMeshCacheStats();
+
+		auto t0 = std::chrono::high_resolution_clock::now();
+		MappedFile file;
+		if (!file.Open(path))
+			return HEMeshCacheError::OpenFailed;
+		stats->bytes = file.Size();
+		auto t1 = std::chrono::high_resolution_clock::now();
+		stats->mapMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+		HEMeshCacheHeader header;
+		if (file.Size() < sizeof(header))
+			return HEMeshCacheError::BadHeader;
+		std::memcpy(&header, file.Data(), sizeof(header));
+		if (std::memcmp(header.magic, HEMESH_CACHE_MAGIC, sizeof(header.magic)) != 0)
+			return HEMeshCacheError::BadHeader;
+		if (header.version != HEMESH_CACHE_VERSION)
+			return HEMeshCacheError::VersionMismatch;
+		if (header.numVertices < 0 || header.numFaces < 0 || header.numHalfEdges < 3 * static_cast<int64_t>(header.numFaces) || header.numScalars < 0
+			|| header.payloadBytes != file.Size() - sizeof(header) || payloadSize(header) > header.payloadBytes)
+			return HEMeshCacheError::BadHeader;
+		if (header.sourceChecksum != sourceChecksum)
+			return HEMeshCacheError::StaleSource;
+		const char* payload = file.Data() + sizeof(header);
+		if (checksum64(payload, header.payloadBytes, numThreads) != header.payloadChecksum)
+			return HEMeshCacheError::Corrupt;
+		auto t2 = std::chrono::high_resolution_clock::now();
+		stats->checksumMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+		const int n = header.numVertices;
+		const int numHalfEdges = header.numHalfEdges;
+		stats->vertices = n;
+		stats->faces = header.numFaces;
+		stats->halfEdges = numHalfEdges;
+		Topology local;
+		Topology& t = topo ? *topo : local;
+		t.numVertices = n;
+		t.numFaces = header.numFaces;
+		const char* p = payload;
+		auto read = [&](std::vector<int>& dst, int count) {
+			const int32_t* src = reinterpret_cast<const int32_t*>(p);
+			dst.assign(src, src + count);
+			p += alignedSize(count * sizeof(int32_t));
+		};
+		read(t.next, numHalfEdges);
+		read(t.pair, numHalfEdges);
+		read(t.origin, numHalfEdges);
+		read(t.face, numHalfEdges);
+		read(t.vertexHalfEdge, n);
+
+		// Уֻ𻵣±ṹ飺±ڷΧڣpair ޲ĶԺϣ
+		// pair  next 㣬ǰ 3 * numFaces ߰šΪ߽ߣİߴӸö
+		// ͬһεȲ鷶ΧٶָԪأԽ
+		const int numInteriorHalfEdges = 3 * t.numFaces;
+		std::atomic<bool> bad{ false };
+		parallelFor(numHalfEdges, numThreads, [&](int h) {
+			const int next = t.next[h], pair = t.pair[h];
+			if (static_cast<unsigned>(next) >= static_cast<unsigned>(numHalfEdges) || static_cast<unsigned>(pair) >= static_cast<unsigned>(numHalfEdges)
+				|| static_cast<unsigned>(t.origin[h]) >= static_cast<unsigned>(n)
+				|| pair == h || t.pair[pair] != h || t.origin[pair] != t.origin[next]
+				|| t.face[h] != (h < numInteriorHalfEdges ? h / 3 : -1))
+				bad.store(true, std::memory_order_relaxed);
+		});
+		parallelFor(n, numThreads, [&](int v) {
+			const int h = t.vertexHalfEdge[v];
+			if (h < -1 || h >= numHalfEdges || (h >= 0 && t.origin[h] != v))
+				bad.store(true, std::memory_order_relaxed);
+		});
+		if (bad)
+			return HEMeshCacheError::Corrupt;
+		auto t3 = std::chrono::high_resolution_clock::now();
+		stats->topologyMs = std::chrono::duration<double, std::milli>(t3 - t2).count();
+
+		const Ubpa::pointf3* positions = reinterpret_cast<const Ubpa::pointf3*>(p);
+		p += 3 * static_cast<size_t>(n) * sizeof(float);
+		const Ubpa::normalf* normals = nullptr;
+		if (header.flags & HEMESH_CACHE_NORMALS) {
+			normals = reinterpret_cast<const Ubpa::normalf*>(p);
+			p += 3 * static_cast<size_t>(n) * sizeof(float);
+		}
+		// ȷϱԶļڣٸĶ mesh
+		const char* end = payload + header.payloadBytes;
+		std::vector<std::pair<std::string, const float*>> scalars;
+		for (int s = 0; s < header.numScalars; ++s) {
+			uint32_t length;
+			if (end - p < static_cast<ptrdiff_t>(sizeof(length)))
+				return HEMeshCacheError::Corrupt;
+			std::memcpy(&length, p, sizeof(length));
+			p += sizeof(length);
+			if (static_cast<size_t>(end - p) < alignedSize(length) + n * sizeof(float))
+				return HEMeshCacheError::Corrupt;
+			std::string name(p, length);
+			p += alignedSize(length);
+			scalars.emplace_back(std::move(name), reinterpret_cast<const float*>(p));
+			p += n * sizeof(float);
+		}
+
+		if (!fillHEMesh(t, positions, mesh))
+			return HEMeshCacheError::BadTopology;
+		if (normals)
+			std::copy(normals, normals + n, mesh.normals.begin());
+		for (const auto& [name, values] : scalars)
+			mesh.scalars[name].assign(values, values + n);
+		auto t4 = std::chrono::high_resolution_clock::now();
+		stats->elementsMs = std::chrono::duration<double, std::milli>(t4 - t3).count();
+		return HEMeshCacheError::None;
+	}
+}
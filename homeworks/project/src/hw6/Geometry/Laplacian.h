@@ -0,0 +1,295 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/**********************************************************************************
+/// @file       Laplacian.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief       Laplace Ļ
+/// @details    L_ij = (cot a + cot b) / 2L_ii = -sum_j L_ij CSR 洢ΪĻ Voronoi 
+///             ȰβÿǵϵٰС㲢лܣûдͻ
+///             ˰汾ʱֻƶĶΣԼЩζ
+**********************************************************************************/
+
+namespace Geometry {
+	enum class MassType { Barycentric, Voronoi };
+
+	struct LaplacianStats {
+		bool topology{ false };		// ؽϡṹ
+		int changedVertices{ 0 };
+		int updatedFaces{ 0 };
+		int updatedRows{ 0 };
+		double structureMs{ 0.0 };
+		double valuesMs{ 0.0 };
+	};
+
+	class Laplacian {
+	public:
+		/*
+		/// @brief      ʹǰλһ
+		/// @details    ˰汾仯ʱؽ CSR ṹȫֵͱ仯ʱȫֵ
+		///             ϴελñȽϣֻӰĲ
+		/// @param[in]  :
+		/// @return     ͳϢ
+		/// @attention  Ҫ
+		*/
+		const LaplacianStats& Update(HEMeshX& mesh, MassType massType = MassType::Voronoi, int numThreads = 1) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			stats = LaplacianStats();
+			stats.topology = !valid || topologyVersion != mesh.TopologyVersion() || positions.size() != mesh.positions.size();
+			if (stats.topology)
+				BuildStructure(mesh, numThreads);
+			const bool all = stats.topology || massType != this->massType;
+			this->massType = massType;
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.structureMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+			const int n = NumVertices();
+			const int m = static_cast<int>(indices.size() / 3);
+			std::vector<int> chunkCountChanged(chunkCount(n, numThreads), 0);
+			parallelChunks(n, numThreads, [&](int chunk, int begin, int end) {
+				int count = 0;
+				for (int i = begin; i < end; ++i) {
+					const Ubpa::pointf3& p = mesh.positions[i];
+					const bool changed = all || p[0] != positions[i][0] || p[1] != positions[i][1] || p[2] != positions[i][2];
+					vertexChanged[i] = changed ? 1 : 0;
+					if (changed) {
+						positions[i] = p;
+						++count;
+					}
+				}
+				chunkCountChanged[chunk] = count;
+			});
+			for (int count : chunkCountChanged)
+				stats.changedVertices += count;
+			if (stats.changedVertices > 0) {
+				std::vector<int> chunkFaces(chunkCount(m, numThreads), 0);
+				parallelChunks(m, numThreads, [&](int chunk, int begin, int end) {
+					int count = 0;
+					for (int f = begin; f < end; ++f) {
+						const int* t = indices.data() + 3 * f;
+						faceChanged[f] = vertexChanged[t[0]] | vertexChanged[t[1]] | vertexChanged[t[2]];
+						if (faceChanged[f]) {
+							UpdateCorners(f);
+							++count;
+						}
+					}
+					chunkFaces[chunk] = count;
+				});
+				std::vector<int> chunkRows(chunkCount(n, numThreads), 0);
+				parallelChunks(n, numThreads, [&](int chunk, int begin, int end) {
+					int count = 0;
+					for (int i = begin; i < end; ++i) {
+						if (UpdateRow(i))
+							++count;
+					}
+					chunkRows[chunk] = count;
+				});
+				for (int count : chunkFaces)
+					stats.updatedFaces += count;
+				for (int count : chunkRows)
+					stats.updatedRows += count;
+			}
+			auto t2 = std::chrono::high_resolution_clock::now();
+			stats.valuesMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+			return stats;
+		}
+
+		int NumVertices() const { return static_cast<int>(diagonal.size()); }
+
+		size_t TopologyVersion() const { return topologyVersion; }
+
+		//  i кֵΪ columns/values[rowOffsets[i], rowOffsets[i+1])кŵԽԪ
+		const std::vector<int>& RowOffsets() const { return rowOffsets; }
+		const std::vector<int>& Columns() const { return columns; }
+		const std::vector<double>& Values() const { return values; }
+		// ԽԪ values еλ
+		const std::vector<int>& Diagonal() const { return diagonal; }
+		const std::vector<double>& Mass() const { return mass; }
+
+		const LaplacianStats& Stats() const { return stats; }
+
+	private:
+		/*
+		/// @brief       CSR ṹ
+		/// @details     (v0, v1, v2) Ľ k ű (v_{k+1}, v_{k+2})ÿǶԽԪ¶
+		/// @param[in]  :
+		/// @return
+		/// @attention
+		*/
+		void BuildStructure(HEMeshX& mesh, int numThreads) {
+			assert(mesh.AttributesInSync());
+			topologyVersion = mesh.TopologyVersion();
+			const int n = static_cast<int>(mesh.Vertices().size());
+			const int m = static_cast<int>(mesh.Polygons().size());
+			indices.resize(3 * static_cast<size_t>(m));
+			parallelFor(m, numThreads, [&](int f) {
+				auto* he = mesh.Polygons().at(f)->HalfEdge();
+				for (int k = 0; k < 3; ++k) {
+					indices[3 * f + k] = he->Origin()->index;
+					he = he->Next();
+				}
+			});
+
+			// ڵĽ
+			cornerOffsets.assign(n + 1, 0);
+			for (int v : indices)
+				++cornerOffsets[v + 1];
+			for (int i = 0; i < n; ++i)
+				cornerOffsets[i + 1] += cornerOffsets[i];
+			vertexCorners.resize(indices.size());
+			std::vector<int> cursor(cornerOffsets.begin(), cornerOffsets.end() - 1);
+			for (int c = 0; c < 3 * m; ++c)
+				vertexCorners[cursor[indices[c]]++] = c;
+
+			// ԽУ󰴿˳ƴ
+			const int chunks = chunkCount(n, numThreads);
+			std::vector<std::vector<int>> chunkColumns(chunks), chunkOpposite(chunks);
+			rowOffsets.assign(n + 1, 0);
+			diagonal.resize(n);
+			parallelChunks(n, numThreads, [&](int chunk, int begin, int end) {
+				std::vector<std::pair<int, int>> around;	// (ڶ, ŸñߵĽ)
+				auto& cols = chunkColumns[chunk];
+				auto& opposite = chunkOpposite[chunk];
+				for (int i = begin; i < end; ++i) {
+					around.clear();
+					for (int e = cornerOffsets[i]; e < cornerOffsets[i + 1]; ++e) {
+						const int c = vertexCorners[e];
+						const int f = c / 3, k = c % 3;
+						around.emplace_back(indices[3 * f + (k + 1) % 3], 3 * f + (k + 2) % 3);
+						around.emplace_back(indices[3 * f + (k + 2) % 3], 3 * f + (k + 1) % 3);
+					}
+					around.emplace_back(i, -1);
+					std::sort(around.begin(), around.end());
+					for (size_t a = 0; a < around.size();) {
+						size_t b = a + 1;
+						while (b < around.size() && around[b].first == around[a].first)
+							++b;
+						if (around[a].first == i)
+							diagonal[i] = static_cast<int>(cols.size());	// λãƴʱƫ
+						cols.push_back(around[a].first);
+						opposite.push_back(around[a].second);
+						opposite.push_back(b - a > 1 ? around[a + 1].second : -1);
+						a = b;
+					}
+					rowOffsets[i + 1] = static_cast<int>(cols.size());
+				}
+			});
+			columns.clear();
+			entryCorners.clear();
+			for (int c = 0, i = 0; c < chunks; ++c) {
+				const int base = static_cast<int>(columns.size());
+				const int end = static_cast<int>(static_cast<long long>(n) * (c + 1) / chunks);
+				for (; i < end; ++i) {
+					rowOffsets[i + 1] += base;
+					diagonal[i] += base;
+				}
+				columns.insert(columns.end(), chunkColumns[c].begin(), chunkColumns[c].end());
+				entryCorners.insert(entryCorners.end(), chunkOpposite[c].begin(), chunkOpposite[c].end());
+			}
+
+			values.assign(columns.size(), 0.0);
+			mass.assign(n, 0.0);
+			cornerCot.assign(3 * static_cast<size_t>(m), 0.0);
+			cornerArea.assign(3 * static_cast<size_t>(m), 0.0);
+			positions.resize(n);
+			vertexChanged.resize(n);
+			faceChanged.resize(m);
+			valid = true;
+		}
+
+		//  f ǵϵ
+		void UpdateCorners(int f) {
+			const int* t = indices.data() + 3 * f;
+			double e[3][3];	// e[k] Ϊ k Աߵ v_{k+2} - v_{k+1}
+			double len2[3];
+			for (int k = 0; k < 3; ++k) {
+				const Ubpa::pointf3& p = positions[t[(k + 1) % 3]];
+				const Ubpa::pointf3& q = positions[t[(k + 2) % 3]];
+				for (int d = 0; d < 3; ++d)
+					e[k][d] = static_cast<double>(q[d]) - p[d];
+				len2[k] = e[k][0] * e[k][0] + e[k][1] * e[k][1] + e[k][2] * e[k][2];
+			}
+			const double cx = e[0][1] * e[1][2] - e[0][2] * e[1][1];
+			const double cy = e[0][2] * e[1][0] - e[0][0] * e[1][2];
+			const double cz = e[0][0] * e[1][1] - e[0][1] * e[1][0];
+			const double cross = std::sqrt(cx * cx + cy * cy + cz * cz);
+			const double area = 0.5 * cross;
+			double cot[3];
+			for (int k = 0; k < 3; ++k) {
+				//  k Ϊ -e[k+2]  e[k+1]
+				const double* u = e[(k + 2) % 3];
+				const double* v = e[(k + 1) % 3];
+				const double dot = -(u[0] * v[0] + u[1] * v[1] + u[2] * v[2]);
+				cot[k] = cross > 1e-30 ? dot / cross : 0.0;
+				cornerCot[3 * f + k] = cot[k];
+			}
+			for (int k = 0; k < 3; ++k) {
+				double a;
+				if (massType == MassType::Barycentric)
+					a = area / 3.0;
+				else if (cot[k] < 0.0)
+					a = area / 2.0;	// ۽ڵĽ
+				else if (cot[(k + 1) % 3] < 0.0 || cot[(k + 2) % 3] < 0.0)
+					a = area / 4.0;
+				else	// Ƕ۽ȡ Voronoi  k ڵ߷ֱŽ k+1  k+2
+					a = (len2[(k + 2) % 3] * cot[(k + 2) % 3] + len2[(k + 1) % 3] * cot[(k + 1) % 3]) / 8.0;
+				cornerArea[3 * f + k] = a;
+			}
+		}
+
+		// б仯ʱ i Ƿ
+		bool UpdateRow(int i) {
+			bool dirty = false;
+			for (int e = cornerOffsets[i]; e < cornerOffsets[i + 1] && !dirty; ++e)
+				dirty = faceChanged[vertexCorners[e] / 3] != 0;
+			if (!dirty)
+				return false;
+			double sum = 0.0;
+			for (int e = rowOffsets[i]; e < rowOffsets[i + 1]; ++e) {
+				if (e == diagonal[i])
+					continue;
+				double w = 0.0;
+				for (int s = 0; s < 2; ++s) {
+					const int c = entryCorners[2 * e + s];
+					if (c >= 0)
+						w += 0.5 * cornerCot[c];
+				}
+				values[e] = w;
+				sum += w;
+			}
+			values[diagonal[i]] = -sum;
+			double a = 0.0;
+			for (int e = cornerOffsets[i]; e < cornerOffsets[i + 1]; ++e)
+				a += cornerArea[vertexCorners[e]];
+			mass[i] = a;
+			return true;
+		}
+
+		bool valid{ false };
+		size_t topologyVersion{ 0 };
+		MassType massType{ MassType::Voronoi };
+		std::vector<int> indices;			// ÿε㣬 c Ϊ indices[c]
+		std::vector<int> cornerOffsets;		//  i ڵĽΪ vertexCorners[cornerOffsets[i], cornerOffsets[i+1])
+		std::vector<int> vertexCorners;
+		std::vector<int> rowOffsets;
+		std::vector<int> columns;
+		std::vector<int> entryCorners;		// ÿԪŸñߵĽǣûʱΪ -1
+		std::vector<int> diagonal;
+		std::vector<double> values;
+		std::vector<double> mass;
+		std::vector<double> cornerCot, cornerArea;
+		std::vector<Ubpa::pointf3> positions;	// ϴθʱλ
+		std::vector<char> vertexChanged, faceChanged;
+		LaplacianStats stats;
+	};
+}
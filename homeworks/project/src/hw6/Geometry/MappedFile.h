@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**********************************************************************************
+/// @file       MappedFile.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ֻڴӳļ
+/// @details    Windows  CreateFileMapping/MapViewOfFileƽ̨ mmap
+///             ļֱӰҳ룬߳̿ͬʱͬλöĻ
+**********************************************************************************/
+
+namespace Geometry {
+	class MappedFile {
+	public:
+		MappedFile() = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() { Close(); }
+
+		/*
+		/// @brief      ӳļ
+		/// @details    ļҲɹData Ϊ nullptr
+		/// @param[in]  :
+		/// @return     򿪻ӳʧʱ false
+		/// @attention  Ѵ򿪵ļȹر
+		*/
+		bool Open(const std::string& path) {
+			Close();
+#ifdef _WIN32
+			file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (file == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(file, &fileSize)) {
+				Close();
+				return false;
+			}
+			size = static_cast<size_t>(fileSize.QuadPart);
+			if (size > 0) {
+				mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (!mapping) {
+					Close();
+					return false;
+				}
+				data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+				if (!data) {
+					Close();
+					return false;
+				}
+			}
+#else
+			fd = open(path.c_str(), O_RDONLY);
+			if (fd < 0)
+				return false;
+			struct stat st;
+			if (fstat(fd, &st) != 0) {
+				Close();
+				return false;
+			}
+			size = static_cast<size_t>(st.st_size);
+			if (size > 0) {
+				void* p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (p == MAP_FAILED) {
+					Close();
+					return false;
+				}
+				// ̴߳Ӳͬλÿʼ˳ں˾Ԥ
+				madvise(p, size, MADV_WILLNEED);
+				data = static_cast<const char*>(p);
+			}
+#endif
+			opened = true;
+			return true;
+		}
+
+		void Close() {
+#ifdef _WIN32
+			if (data)
+				UnmapViewOfFile(data);
+			if (mapping)
+				CloseHandle(mapping);
+			if (file != INVALID_HANDLE_VALUE)
+				CloseHandle(file);
+			mapping = nullptr;
+			file = INVALID_HANDLE_VALUE;
+#else
+			if (data)
+				munmap(const_cast<char*>(data), size);
+			if (fd >= 0)
+				close(fd);
+			fd = -1;
+#endif
+			data = nullptr;
+			size = 0;
+			opened = false;
+		}
+
+		bool IsOpen() const { return opened; }
+
+		const char* Data() const { return data; }
+
+		size_t Size() const { return size; }
+
+	private:
+#ifdef _WIN32
+		HANDLE file{ INVALID_HANDLE_VALUE };
+		HANDLE mapping{ nullptr };
+#else
+		int fd{ -1 };
+#endif
+		const char* data{ nullptr };
+		size_t size{ 0 };
+		bool opened{ false };
+	};
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "Laplacian.h"
+#include "Parallel.h"
+
+#include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+/**********************************************************************************
+/// @file       MeanCurvatureFlow.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ʽƽ
+/// @details    ÿ (M - hL) x = M x_oldL  M ȡԵǰ棨Laplacian 棬ֻƶĲ֣
+///             ߽綥̶ƵҶˣ˲ʱŷֻֽһΣֵֽͺ£
+///             ϴηֽı仯ݲʱþɷֽϸǰ̵Ľ⣬ʱ·ֽ
+**********************************************************************************/
+
+namespace Geometry {
+	// ͺֽʱϸ·ֽ
+	constexpr int MCF_MAX_REFINEMENTS = 8;
+	// ϸԲвλΪ floatСû
+	constexpr double MCF_REFINE_TOLERANCE = 1e-7;
+
+	struct MeanCurvatureFlowStats {
+		int interior{ 0 };
+		bool analyzed{ false };		// ˷ŷֽ
+		bool factorized{ false };	// ֵֽ
+		double lag{ 0.0 };			// ϴηֽı仯
+		int refinements{ 0 };
+		double residual{ 0.0 };
+		double laplacianMs{ 0.0 };	//  L  M
+		double assembleMs{ 0.0 };	// ҶͺȽ
+		double analyzeMs{ 0.0 };
+		double factorizeMs{ 0.0 };
+		double solveMs{ 0.0 };
+	};
+
+	class MeanCurvatureFlow {
+	public:
+		/*
+		/// @brief      һʽƽ
+		/// @details    h = stepSize * ƽ߶޹أ
+		///             ˰汾仯ʱԶؽϡṹŷֽ
+		/// @param[in]  : stepSize : ٲԽԽƽ
+		/// @param[in]  : lagTolerance : ԶԽԪ仯ʱϴεֵֽ⣬Ϊ 0 ʱÿֽ
+		/// @return     ʧʱ false񲻱
+		/// @attention  ҪΪ 0 Ĺ߽綥һ̶
+		*/
+		bool Step(HEMeshX& mesh, float stepSize, float lagTolerance, int numThreads = 1) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			stats = MeanCurvatureFlowStats();
+			laplacian.Update(mesh, MassType::Voronoi, numThreads);
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.laplacianMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+			if (!valid || topologyVersion != laplacian.TopologyVersion()) {
+				BuildStructure(mesh);
+				auto t2 = std::chrono::high_resolution_clock::now();
+				stats.analyzeMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+				t1 = t2;
+				if (!valid)
+					return false;
+				stats.analyzed = true;
+			}
+			const int m = static_cast<int>(interiorVertices.size());
+			stats.interior = m;
+			if (m == 0)
+				return true;
+
+			const auto& rowOffsets = laplacian.RowOffsets();
+			const auto& columns = laplacian.Columns();
+			const auto& lValues = laplacian.Values();
+			const auto& mass = laplacian.Mass();
+			const int n = laplacian.NumVertices();
+			const auto& positions = mesh.positions;
+			double totalMass = 0.0;
+			for (double a : mass)
+				totalMass += a;
+			const double h = stepSize * totalMass / n;
+
+			// A = M_II - h L_IIb = M_I x_I + h L_IB x_BL Գƣ r м L ĵ i 
+			double* values = A.valuePtr();
+			Eigen::MatrixX3d b(m, 3);
+			std::vector<double> chunkLag(chunkCount(m, numThreads), 0.0);
+			parallelChunks(m, numThreads, [&](int chunk, int begin, int end) {
+				double lag = 0.0;
+				for (int r = begin; r < end; ++r) {
+					const int i = interiorVertices[r];
+					double bx = mass[i] * positions[i][0], by = mass[i] * positions[i][1], bz = mass[i] * positions[i][2];
+					double change = 0.0;
+					int k = A.outerIndexPtr()[r];
+					for (int e = rowOffsets[i]; e < rowOffsets[i + 1]; ++e) {
+						const int j = columns[e];
+						if (interior[j] < 0) {
+							bx += h * lValues[e] * positions[j][0];
+							by += h * lValues[e] * positions[j][1];
+							bz += h * lValues[e] * positions[j][2];
+							continue;
+						}
+						values[k] = (j == i ? mass[i] : 0.0) - h * lValues[e];
+						change = std::max(change, std::abs(values[k] - factored[k]));
+						++k;
+					}
+					b(r, 0) = bx;
+					b(r, 1) = by;
+					b(r, 2) = bz;
+					lag = std::max(lag, change / values[diagonalIndex[r]]);
+				}
+				chunkLag[chunk] = lag;
+			});
+			for (double lag : chunkLag)
+				stats.lag = std::max(stats.lag, lag);
+			auto t2 = std::chrono::high_resolution_clock::now();
+			stats.assembleMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+			if (!hasFactor || stats.lag > lagTolerance) {
+				if (!Factorize())
+					return false;
+			}
+			auto t3 = std::chrono::high_resolution_clock::now();
+			stats.factorizeMs = std::chrono::duration<double, std::milli>(t3 - t2).count();
+
+			Eigen::MatrixX3d x;
+			if (!stats.factorized && !Refine(b, x)) {
+				// ɷֽ뵱ǰ̫Զϸ
+				auto t4 = std::chrono::high_resolution_clock::now();
+				if (!Factorize())
+					return false;
+				t3 = std::chrono::high_resolution_clock::now();
+				stats.factorizeMs += std::chrono::duration<double, std::milli>(t3 - t4).count();
+			}
+			if (stats.factorized) {
+				x = ldlt.solve(b);
+				if (ldlt.info() != Eigen::Success)
+					return false;
+				stats.residual = (b - A * x).norm() / std::max(b.norm(), 1e-300);
+			}
+			if (!x.allFinite())
+				return false;
+			parallelFor(m, numThreads, [&](int r) {
+				const int i = interiorVertices[r];
+				mesh.positions[i] = Ubpa::pointf3(static_cast<float>(x(r, 0)), static_cast<float>(x(r, 1)), static_cast<float>(x(r, 2)));
+			});
+			auto t4 = std::chrono::high_resolution_clock::now();
+			stats.solveMs = std::chrono::duration<double, std::milli>(t4 - t3).count();
+			return true;
+		}
+
+		// Ľṹֽ
+		void Clear() {
+			valid = false;
+			hasFactor = false;
+			interiorVertices.clear();
+		}
+
+		// ϡṹӦ˰汾
+		size_t TopologyVersion() const { return topologyVersion; }
+
+		const Laplacian& GetLaplacian() const { return laplacian; }
+
+		const MeanCurvatureFlowStats& Stats() const { return stats; }
+
+	private:
+		/*
+		/// @brief       Laplacian  CSR ṹڲľŷֽ
+		/// @details    ڲ㰴±ţL ÿек԰д뼴Ϊ
+		/// @param[in]  :
+		/// @return
+		/// @attention  ʧʱ valid Ϊ false
+		*/
+		void BuildStructure(HEMeshX& mesh) {
+			valid = false;
+			hasFactor = false;
+			topologyVersion = laplacian.TopologyVersion();
+			const auto& boundary = mesh.Boundary();
+			const auto& rowOffsets = laplacian.RowOffsets();
+			const auto& columns = laplacian.Columns();
+			const auto& mass = laplacian.Mass();
+			const int n = laplacian.NumVertices();
+
+			interior.assign(n, -1);
+			interiorVertices.clear();
+			for (int i = 0; i < n; ++i) {
+				if (!boundary.IsBoundary(i) && mass[i] > 0.0) {
+					interior[i] = static_cast<int>(interiorVertices.size());
+					interiorVertices.push_back(i);
+				}
+			}
+			const int m = static_cast<int>(interiorVertices.size());
+
+			A.resize(m, m);
+			Eigen::VectorXi columnSize(m);
+			for (int r = 0; r < m; ++r) {
+				const int i = interiorVertices[r];
+				int count = 0;
+				for (int e = rowOffsets[i]; e < rowOffsets[i + 1]; ++e)
+					count += interior[columns[e]] >= 0 ? 1 : 0;
+				columnSize[r] = count;
+			}
+			A.reserve(columnSize);
+			diagonalIndex.resize(m);
+			int nnz = 0;
+			for (int r = 0; r < m; ++r) {
+				const int i = interiorVertices[r];
+				for (int e = rowOffsets[i]; e < rowOffsets[i + 1]; ++e) {
+					const int j = columns[e];
+					if (interior[j] < 0)
+						continue;
+					A.insert(interior[j], r) = j == i ? 1.0 : 0.0;
+					if (j == i)
+						diagonalIndex[r] = nnz;
+					++nnz;
+				}
+			}
+			A.makeCompressed();
+			factored.assign(A.nonZeros(), 0.0);
+			if (m > 0) {
+				ldlt.analyzePattern(A);
+				if (ldlt.info() != Eigen::Success)
+					return;
+			}
+			valid = true;
+		}
+
+		bool Factorize() {
+			ldlt.factorize(A);
+			hasFactor = ldlt.info() == Eigen::Success;
+			if (hasFactor)
+				std::copy(A.valuePtr(), A.valuePtr() + A.nonZeros(), factored.begin());
+			stats.factorized = hasFactor;
+			return hasFactor;
+		}
+
+		// ϴηֽΪԤϸx += F^{-1} (b - A x)
+		bool Refine(const Eigen::MatrixX3d& b, Eigen::MatrixX3d& x) {
+			const double norm = std::max(b.norm(), 1e-300);
+			x = ldlt.solve(b);
+			for (int k = 0; k < MCF_MAX_REFINEMENTS; ++k) {
+				Eigen::MatrixX3d r = b - A * x;
+				stats.residual = r.norm() / norm;
+				if (!(stats.residual > MCF_REFINE_TOLERANCE))
+					return std::isfinite(stats.residual);
+				x += ldlt.solve(r);
+				stats.refinements = k + 1;
+			}
+			stats.residual = (b - A * x).norm() / norm;
+			return stats.residual <= MCF_REFINE_TOLERANCE;
+		}
+
+		bool valid{ false };
+		bool hasFactor{ false };
+		size_t topologyVersion{ 0 };
+		Laplacian laplacian;
+		std::vector<int> interior;			// ڲеţ̶ĵΪ -1
+		std::vector<int> interiorVertices;
+		std::vector<int> diagonalIndex;
+		std::vector<double> factored;		// ϴֵֽʱľֵ
+		Eigen::SparseMatrix<double> A;
+		Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+		MeanCurvatureFlowStats stats;
+	};
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "Parallel.h"
+
+#include <Utopia/Render/Mesh.h>
+
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**********************************************************************************
+/// @file       MeshExport.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      HEMeshX  Mesh 
+/// @details    ˲ʱ± -  CSR ֻһΣÿεռλãϴαȽϣ
+///             ֻ仯ķ򣨲ȨЩ϶ķ
+///             㷨ÿ֡ʱֻƶĴƶĶ
+**********************************************************************************/
+
+namespace Geometry {
+	struct MeshExportStats {
+		bool topology{ false };		// ؽ±
+		int changedVertices{ 0 };
+		int updatedNormals{ 0 };
+		double gatherMs{ 0.0 };		// ±λ
+		double normalsMs{ 0.0 };
+		double uploadMs{ 0.0 };		// д Mesh
+	};
+
+	class MeshExporter {
+	public:
+		/*
+		/// @brief       HEMeshX λá±뷨д meshͬʱ HEMeshX::normals
+		/// @details    ˰汾仯ù Invalidate ʱؽ±ֻ꣬λñ仯Ĳ
+		/// @param[in]  :
+		/// @return     ͳϢ
+		/// @attention  Ҫ Mesh ꣬ɵ߾Ƿ GenTangents
+		*/
+		const MeshExportStats& Export(HEMeshX& mesh, Ubpa::Utopia::Mesh& out, int numThreads = 1) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			stats = MeshExportStats();
+			const int n = static_cast<int>(mesh.Vertices().size());
+			const int m = static_cast<int>(mesh.Polygons().size());
+			stats.topology = !valid || topologyVersion != mesh.TopologyVersion() || static_cast<int>(positions.size()) != n || static_cast<int>(indices.size()) != 3 * m;
+			if (stats.topology)
+				BuildIndices(mesh, numThreads);
+
+			std::vector<int> chunkChanged(chunkCount(n, numThreads), 0);
+			parallelChunks(n, numThreads, [&](int chunk, int begin, int end) {
+				int count = 0;
+				for (int i = begin; i < end; ++i) {
+					const Ubpa::pointf3& p = mesh.positions[i];
+					const bool changed = stats.topology || p[0] != positions[i][0] || p[1] != positions[i][1] || p[2] != positions[i][2];
+					vertexChanged[i] = changed ? 1 : 0;
+					if (changed) {
+						positions[i] = p;
+						++count;
+					}
+				}
+				chunkChanged[chunk] = count;
+			});
+			for (int count : chunkChanged)
+				stats.changedVertices += count;
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.gatherMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+			if (stats.changedVertices > 0)
+				UpdateNormals(mesh.normals, numThreads);
+			auto t2 = std::chrono::high_resolution_clock::now();
+			stats.normalsMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+			out.SetToEditable();
+			out.SetPositions(positions);
+			if (stats.topology) {
+				out.SetIndices(indices);
+				out.SetSubMeshCount(1);
+				out.SetSubMesh(0, { 0, indices.size() });
+			}
+			out.SetNormals(mesh.normals);
+			auto t3 = std::chrono::high_resolution_clock::now();
+			stats.uploadMs = std::chrono::duration<double, std::milli>(t3 - t2).count();
+			return stats;
+		}
+
+		// Mesh 滻ã´εʱؽ±겢дȫݣ˸ıɰ汾Զ
+		void Invalidate() { valid = false; }
+
+		const std::vector<uint32_t>& Indices() const { return indices; }
+
+		const MeshExportStats& Stats() const { return stats; }
+
+	private:
+		void BuildIndices(HEMeshX& mesh, int numThreads) {
+			assert(mesh.AttributesInSync());
+			const int n = static_cast<int>(mesh.Vertices().size());
+			const int m = static_cast<int>(mesh.Polygons().size());
+			indices.resize(3 * static_cast<size_t>(m));
+			parallelFor(m, numThreads, [&](int f) {
+				auto* he = mesh.Polygons().at(f)->HalfEdge();
+				for (int k = 0; k < 3; ++k) {
+					indices[3 * f + k] = static_cast<uint32_t>(he->Origin()->index);
+					he = he->Next();
+				}
+			});
+
+			// ڵ棬±
+			faceOffsets.assign(n + 1, 0);
+			for (uint32_t v : indices)
+				++faceOffsets[v + 1];
+			for (int i = 0; i < n; ++i)
+				faceOffsets[i + 1] += faceOffsets[i];
+			incidentFaces.resize(indices.size());
+			std::vector<int> cursor(faceOffsets.begin(), faceOffsets.end() - 1);
+			for (int h = 0; h < 3 * m; ++h)
+				incidentFaces[cursor[indices[h]]++] = h / 3;
+
+			positions.resize(n);
+			vertexChanged.resize(n);
+			faceNormals.resize(m);
+			faceChanged.resize(m);
+			topologyVersion = mesh.TopologyVersion();
+			valid = true;
+		}
+
+		void UpdateNormals(std::vector<Ubpa::normalf>& normals, int numThreads) {
+			const int n = static_cast<int>(positions.size());
+			const int m = static_cast<int>(faceNormals.size());
+			parallelFor(m, numThreads, [&](int f) {
+				const uint32_t* t = indices.data() + 3 * f;
+				faceChanged[f] = vertexChanged[t[0]] | vertexChanged[t[1]] | vertexChanged[t[2]];
+				if (!faceChanged[f])
+					return;
+				const Ubpa::pointf3& a = positions[t[0]];
+				const Ubpa::pointf3& b = positions[t[1]];
+				const Ubpa::pointf3& c = positions[t[2]];
+				const float ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+				const float vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+				faceNormals[f] = Ubpa::vecf3(uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx);
+			});
+			std::vector<int> chunkUpdated(chunkCount(n, numThreads), 0);
+			parallelChunks(n, numThreads, [&](int chunk, int begin, int end) {
+				int count = 0;
+				for (int i = begin; i < end; ++i) {
+					bool dirty = false;
+					for (int e = faceOffsets[i]; e < faceOffsets[i + 1] && !dirty; ++e)
+						dirty = faceChanged[incidentFaces[e]] != 0;
+					if (!dirty)
+						continue;
+					float x = 0.f, y = 0.f, z = 0.f;
+					for (int e = faceOffsets[i]; e < faceOffsets[i + 1]; ++e) {
+						const Ubpa::vecf3& fn = faceNormals[incidentFaces[e]];
+						x += fn[0];
+						y += fn[1];
+						z += fn[2];
+					}
+					const float len = sqrtf(x * x + y * y + z * z);
+					if (len > 0.f)
+						normals[i] = Ubpa::normalf(x / len, y / len, z / len);
+					++count;
+				}
+				chunkUpdated[chunk] = count;
+			});
+			for (int count : chunkUpdated)
+				stats.updatedNormals += count;
+		}
+
+		bool valid{ false };
+		size_t topologyVersion{ 0 };
+		std::vector<uint32_t> indices;
+		std::vector<int> faceOffsets;		//  i ڵΪ incidentFaces[faceOffsets[i], faceOffsets[i+1])
+		std::vector<int> incidentFaces;
+		std::vector<Ubpa::pointf3> positions;	// ϴελ
+		std::vector<Ubpa::vecf3> faceNormals;	// δһΪ
+		std::vector<char> vertexChanged, faceChanged;
+		MeshExportStats stats;
+	};
+}
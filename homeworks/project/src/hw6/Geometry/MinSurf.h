@@ -0,0 +1,157 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "OneRing.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+/**********************************************************************************
+/// @file       MinSurf.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      Сľֲ
+/// @details    ̶߽ÿεڲƵڵļȨƽJacobi ֱλ㹻С
+///             λÿ飬һԤȽ CSRʱֿ鲢Уλдλ
+**********************************************************************************/
+
+namespace Geometry {
+	struct MinSurfStats {
+		int iterations{ 0 };
+		bool converged{ false };
+		float displacement{ 0.0f };			// һελ
+		double setupMs{ 0.0 };				//  CSR 뿽λ
+		std::vector<double> iterationMs;	// ÿεʱ
+	};
+
+	class LocalMinSurf {
+	public:
+		/*
+		/// @brief      ڽӲλ
+		/// @details
+		/// @param[in]  :
+		/// @return     ûб߽ʱ falseļС˻Ϊһ㣩
+		/// @attention  ˸ıҪµ
+		*/
+		bool Init(HEMeshX& mesh, Weighting weighting) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			this->weighting = weighting;
+			ring.Build(mesh);
+			positions = mesh.positions;
+			next = positions;
+			weights.clear();
+			stats = MinSurfStats();
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.setupMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+			return mesh.Boundary().NumLoops() > 0;
+		}
+
+		/*
+		/// @brief      һ Jacobi 
+		/// @details    Ȩڵй̶ʹÿֵԵ Jacobi ڲûȨʱֲ
+		/// @param[in]  :
+		/// @return     ڲλ
+		/// @attention
+		*/
+		float Iterate(int numThreads = 1) {
+			if (reweight || weights.size() != ring.neighbors.size()) {
+				ring.Weights(weighting, positions, &weights, numThreads);
+				reweight = false;
+			}
+			const int n = ring.NumVertices();
+			std::vector<float> chunkMax(chunkCount(n, numThreads), 0.0f);
+			const Ubpa::pointf3* p = positions.data();
+			Ubpa::pointf3* q = next.data();
+			const float* w = weights.data();
+			parallelChunks(n, numThreads, [&](int chunk, int begin, int end) {
+				float maxMove = 0.0f;
+				for (int i = begin; i < end; ++i) {
+					if (ring.boundary[i]) {
+						q[i] = p[i];
+						continue;
+					}
+					float x = 0.0f, y = 0.0f, z = 0.0f, sum = 0.0f;
+					for (int e = ring.offsets[i]; e < ring.offsets[i + 1]; ++e) {
+						const Ubpa::pointf3& pj = p[ring.neighbors[e]];
+						x += w[e] * pj[0];
+						y += w[e] * pj[1];
+						z += w[e] * pj[2];
+						sum += w[e];
+					}
+					if (sum <= 0.0f) {
+						q[i] = p[i];
+						continue;
+					}
+					q[i] = Ubpa::pointf3(x / sum, y / sum, z / sum);
+					const float dx = q[i][0] - p[i][0], dy = q[i][1] - p[i][1], dz = q[i][2] - p[i][2];
+					maxMove = std::max(maxMove, dx * dx + dy * dy + dz * dz);
+				}
+				chunkMax[chunk] = maxMove;
+			});
+			positions.swap(next);
+			return sqrtf(*std::max_element(chunkMax.begin(), chunkMax.end()));
+		}
+
+		/*
+		/// @brief      ﵽ
+		/// @details    λС tolerance ԰ΧжԽ߳ʱȨ仯
+		///              Pinkall-Polthier ÿλȨٵ rounds 
+		/// @param[in]  : rounds : ȨصȨֻһ
+		/// @return     ͳϢÿεʱ
+		/// @attention  ĻҪȣ״ǰ־ȶ
+		*/
+		const MinSurfStats& Run(int maxIterations, float tolerance, int numThreads = 1, int rounds = 1) {
+			const float threshold = tolerance * Diagonal();
+			int round = 1;
+			for (int it = 0; it < maxIterations; ++it) {
+				auto t0 = std::chrono::high_resolution_clock::now();
+				stats.displacement = Iterate(numThreads);
+				auto t1 = std::chrono::high_resolution_clock::now();
+				stats.iterationMs.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+				++stats.iterations;
+				if (stats.displacement <= threshold) {
+					if (weighting == Weighting::Uniform || round >= rounds) {
+						stats.converged = true;
+						break;
+					}
+					reweight = true;
+					++round;
+				}
+			}
+			return stats;
+		}
+
+		// ѽд
+		void Apply(HEMeshX& mesh) const {
+			std::copy(positions.begin(), positions.end(), mesh.positions.begin());
+		}
+
+		const std::vector<Ubpa::pointf3>& Positions() const { return positions; }
+
+		const MinSurfStats& Stats() const { return stats; }
+
+	private:
+		float Diagonal() const {
+			if (positions.empty())
+				return 0.0f;
+			Ubpa::pointf3 lo = positions[0], hi = positions[0];
+			for (const auto& p : positions) {
+				for (int k = 0; k < 3; ++k) {
+					lo[k] = std::min(lo[k], p[k]);
+					hi[k] = std::max(hi[k], p[k]);
+				}
+			}
+			return sqrtf((hi[0] - lo[0]) * (hi[0] - lo[0]) + (hi[1] - lo[1]) * (hi[1] - lo[1]) + (hi[2] - lo[2]) * (hi[2] - lo[2]));
+		}
+
+		Weighting weighting{ Weighting::Uniform };
+		OneRing ring;
+		std::vector<float> weights;
+		bool reweight{ false };
+		std::vector<Ubpa::pointf3> positions, next;	// λýд
+		MinSurfStats stats;
+	};
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "OneRing.h"
+#include "Parallel.h"
+
+#include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
+#include <Eigen/IterativeLinearSolvers>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+/**********************************************************************************
+/// @file       MinSurfGlobal.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      Сȫַ
+/// @details    ̶߽ڲ sum_j w_ij (x_j - x_i) = 0 L_II x_I = -L_IB x_B
+///             L_II Գ˲ʱϡṹŷֻֽһΣȨر仯ʱֵֻֽ⣬
+///             ߽ƶʱֻҶشڲܶʱòȫ Cholesky ԤĹݶ
+**********************************************************************************/
+
+namespace Geometry {
+	enum class LinearSolver { Auto, LDLT, CG };
+
+	// Auto ʱڲ㳬ùݶ
+	constexpr int GLOBAL_CG_THRESHOLD = 200000;
+	// ݶȵԲвλΪ floatСû
+	constexpr double GLOBAL_CG_TOLERANCE = 1e-7;
+
+	struct MinSurfGlobalStats {
+		int interior{ 0 };
+		bool useCG{ false };
+		bool success{ false };
+		int cgIterations{ 0 };
+		double cgError{ 0.0 };
+		double setupMs{ 0.0 };		// ڽӡֿϡṹ
+		double analyzeMs{ 0.0 };	// ŷֽ
+		double factorizeMs{ 0.0 };	// ֵֽ⣨ݶΪԤӣ
+		double solveMs{ 0.0 };		// Ҷش
+	};
+
+	class GlobalMinSurf {
+	public:
+		/*
+		/// @brief      ڲϡ󲢷ֽ
+		/// @details    ڽڲ/߽绮ֻｨһΣβ룬ÿڱ߶ӦķԪλã
+		///             ֮Ȩʱֱдֵ
+		/// @param[in]  : positions : ±еλãȨ
+		/// @return     ûбֽ߽ʧʱ false
+		/// @attention  ˸ıҪµãɱȽ TopologyVersion ж
+		*/
+		bool Init(HEMeshX& mesh, Weighting weighting, LinearSolver solver, int numThreads = 1) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			this->weighting = weighting;
+			this->solver = solver;
+			topologyVersion = mesh.TopologyVersion();
+			stats = MinSurfGlobalStats();
+			ring.Build(mesh);
+			const int n = ring.NumVertices();
+			positions = mesh.positions;
+
+			interior.assign(n, -1);
+			interiorVertices.clear();
+			for (int i = 0; i < n; ++i) {
+				if (!ring.boundary[i] && ring.offsets[i + 1] > ring.offsets[i]) {
+					interior[i] = static_cast<int>(interiorVertices.size());
+					interiorVertices.push_back(i);
+				}
+			}
+			const int m = static_cast<int>(interiorVertices.size());
+			stats.interior = m;
+			if (m == 0 || m == n)
+				return false;
+			stats.useCG = solver == LinearSolver::CG || (solver == LinearSolver::Auto && m > GLOBAL_CG_THRESHOLD);
+
+			//  r ΪԽԪڲڵ㣬кŵ
+			A.resize(m, m);
+			Eigen::VectorXi columnSize(m);
+			for (int r = 0; r < m; ++r) {
+				const int i = interiorVertices[r];
+				int count = 1;
+				for (int e = ring.offsets[i]; e < ring.offsets[i + 1]; ++e)
+					count += interior[ring.neighbors[e]] >= 0 ? 1 : 0;
+				columnSize[r] = count;
+			}
+			A.reserve(columnSize);
+			valueIndex.assign(ring.neighbors.size(), -1);
+			diagonalIndex.resize(m);
+			std::vector<std::pair<int, int>> column;	// (к, CSR еڱߣԽԪΪ -1)
+			int nnz = 0;
+			for (int r = 0; r < m; ++r) {
+				const int i = interiorVertices[r];
+				column.clear();
+				column.emplace_back(r, -1);
+				for (int e = ring.offsets[i]; e < ring.offsets[i + 1]; ++e) {
+					if (interior[ring.neighbors[e]] >= 0)
+						column.emplace_back(interior[ring.neighbors[e]], e);
+				}
+				std::sort(column.begin(), column.end());
+				for (const auto& [row, e] : column) {
+					A.insert(row, r) = 0.0;
+					if (e < 0)
+						diagonalIndex[r] = nnz;
+					else
+						valueIndex[e] = nnz;
+					++nnz;
+				}
+			}
+			A.makeCompressed();
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.setupMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+			if (!stats.useCG) {
+				ldlt.analyzePattern(A);
+				auto t2 = std::chrono::high_resolution_clock::now();
+				stats.analyzeMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+				if (ldlt.info() != Eigen::Success)
+					return false;
+			}
+			return Refactor(numThreads);
+		}
+
+		/*
+		/// @brief      õǰλȨزֵֽ
+		/// @details    ϡṹ䣬ŷֽ Init Ľ
+		/// @param[in]  :
+		/// @return     ֽʧʱ false
+		/// @attention  Ȩزλñ仯Init ֮ٵ
+		*/
+		bool Refactor(int numThreads = 1) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			ring.Weights(weighting, positions, &weights, numThreads);
+			double* values = A.valuePtr();
+			const int m = static_cast<int>(interiorVertices.size());
+			fixedRow.resize(m);
+			parallelFor(m, numThreads, [&](int r) {
+				const int i = interiorVertices[r];
+				double sum = 0.0;
+				for (int e = ring.offsets[i]; e < ring.offsets[i + 1]; ++e) {
+					sum += weights[e];
+					if (valueIndex[e] >= 0)
+						values[valueIndex[e]] = -weights[e];
+				}
+				// ȨȫΪ 0 ĵ˻Ϊ̶ԽԪȡ 1Solve ʱҶȡǰλ
+				fixedRow[r] = sum > 0.0 ? 0 : 1;
+				values[diagonalIndex[r]] = sum > 0.0 ? sum : 1.0;
+			});
+			if (stats.useCG) {
+				cg.setTolerance(GLOBAL_CG_TOLERANCE);
+				cg.compute(A);
+			}
+			else
+				ldlt.factorize(A);
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.factorizeMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+			return (stats.useCG ? cg.info() : ldlt.info()) == Eigen::Success;
+		}
+
+		/*
+		/// @brief      ϵı߽λڲλ
+		/// @details    ҶΪ߽ڵļȨͣȨȫΪ 0 ĵȡǰλãֽѻ棬ֻشݶԵǰڲλΪֵ
+		/// @param[in]  :
+		/// @return     ʧʱ false
+		/// @attention  ֻȡ߽綥λãڲλ⸲
+		*/
+		bool Solve(HEMeshX& mesh, int numThreads = 1) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			const int n = ring.NumVertices();
+			for (int i = 0; i < n; ++i) {
+				if (interior[i] < 0)
+					positions[i] = mesh.positions[i];
+			}
+			const int m = static_cast<int>(interiorVertices.size());
+			Eigen::MatrixX3d b(m, 3);
+			parallelFor(m, numThreads, [&](int r) {
+				const int i = interiorVertices[r];
+				if (fixedRow[r]) {
+					b(r, 0) = positions[i][0];
+					b(r, 1) = positions[i][1];
+					b(r, 2) = positions[i][2];
+					return;
+				}
+				double x = 0.0, y = 0.0, z = 0.0;
+				for (int e = ring.offsets[i]; e < ring.offsets[i + 1]; ++e) {
+					const int j = ring.neighbors[e];
+					if (interior[j] >= 0)
+						continue;
+					x += weights[e] * positions[j][0];
+					y += weights[e] * positions[j][1];
+					z += weights[e] * positions[j][2];
+				}
+				b(r, 0) = x;
+				b(r, 1) = y;
+				b(r, 2) = z;
+			});
+			Eigen::MatrixX3d x;
+			if (stats.useCG) {
+				Eigen::MatrixX3d guess(m, 3);
+				for (int r = 0; r < m; ++r) {
+					for (int k = 0; k < 3; ++k)
+						guess(r, k) = positions[interiorVertices[r]][k];
+				}
+				x = cg.solveWithGuess(b, guess);
+				stats.cgIterations = static_cast<int>(cg.iterations());
+				stats.cgError = cg.error();
+				stats.success = cg.info() == Eigen::Success;
+			}
+			else {
+				x = ldlt.solve(b);
+				stats.success = ldlt.info() == Eigen::Success;
+			}
+			if (stats.success) {
+				for (int r = 0; r < m; ++r)
+					positions[interiorVertices[r]] = Ubpa::pointf3(static_cast<float>(x(r, 0)), static_cast<float>(x(r, 1)), static_cast<float>(x(r, 2)));
+			}
+			auto t1 = std::chrono::high_resolution_clock::now();
+			stats.solveMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+			return stats.success;
+		}
+
+		// ѽд
+		void Apply(HEMeshX& mesh) const {
+			std::copy(positions.begin(), positions.end(), mesh.positions.begin());
+		}
+
+		// ķֽ⣬´ʹǰҪ Init
+		void Clear() {
+			ring = OneRing();
+			interiorVertices.clear();
+			positions.clear();
+		}
+
+		bool IsInitialized() const { return !interiorVertices.empty(); }
+
+		int NumVertices() const { return ring.NumVertices(); }
+
+		// Init ʱ˰汾ǰ汾ͬʱֽʧЧ
+		size_t TopologyVersion() const { return topologyVersion; }
+
+		Weighting GetWeighting() const { return weighting; }
+
+		LinearSolver GetLinearSolver() const { return solver; }
+
+		const std::vector<Ubpa::pointf3>& Positions() const { return positions; }
+
+		const MinSurfGlobalStats& Stats() const { return stats; }
+
+	private:
+		Weighting weighting{ Weighting::Uniform };
+		LinearSolver solver{ LinearSolver::Auto };
+		size_t topologyVersion{ 0 };
+		OneRing ring;
+		std::vector<float> weights;
+		std::vector<int> interior;			// ڲеţ߽Ϊ -1
+		std::vector<int> interiorVertices;
+		std::vector<int> valueIndex;		// CSR ڱ߶ӦķԪڵڱ߽ʱΪ -1
+		std::vector<int> diagonalIndex;
+		std::vector<char> fixedRow;			// ȨȫΪ 0 ڲΪ 1
+		std::vector<Ubpa::pointf3> positions;
+		Eigen::SparseMatrix<double> A;
+		Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+		Eigen::ConjugateGradient<Eigen::SparseMatrix<double>, Eigen::Lower | Eigen::Upper, Eigen::IncompleteCholesky<double>> cg;
+		MinSurfGlobalStats stats;
+	};
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "Parallel.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**********************************************************************************
+/// @file       Noise.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ɸֵĲж
+/// @details    ڼ Philox4x32-10 (±, ) ΪΪԿ
+///             ÿֻ±ûй״ִ̬߳˳޹
+**********************************************************************************/
+
+namespace Geometry {
+	enum class NoiseType {
+		Uniform,	//  [-scale, scale] Ͼȷֲ
+		Gaussian,	// Ϊ׼ scale ֲ̬
+		Normal		// ض㷨򣬳Ϊ׼ scale ֲ̬
+	};
+
+	/*
+	/// @brief      Philox4x32-10
+	/// @details    Salmon et al. 2011, Parallel random numbers: as easy as 1, 2, 3 Random123 һ
+	/// @param[in]  : counter : 
+	/// @param[in]  : key : Կ
+	/// @return     4 ȷֲ 32 λ
+	/// @attention
+	*/
+	inline std::array<uint32_t, 4> philox4x32(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+		constexpr uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+		constexpr uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+		for (int round = 0; round < 10; ++round) {
+			const uint64_t p0 = static_cast<uint64_t>(M0) * counter[0];
+			const uint64_t p1 = static_cast<uint64_t>(M1) * counter[2];
+			counter = {
+				static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+				static_cast<uint32_t>(p1),
+				static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+				static_cast<uint32_t>(p0)
+			};
+			key[0] += W0;
+			key[1] += W1;
+		}
+		return counter;
+	}
+
+	//  24 λӳ䵽 [0, 1)
+	inline float uniform01(uint32_t x) { return static_cast<float>(x >> 8) * (1.f / 16777216.f); }
+
+	//  24 λӳ䵽 (0, 1]Ĳ
+	inline float uniform01Open(uint32_t x) { return static_cast<float>((x >> 8) + 1) * (1.f / 16777216.f); }
+
+	// Box-Mullerõı׼̬
+	inline void boxMuller(uint32_t a, uint32_t b, float* g0, float* g1) {
+		const float r = std::sqrt(-2.f * std::log(uniform01Open(a)));
+		const float theta = 6.28318530717958647692f * uniform01(b);
+		*g0 = r * std::cos(theta);
+		*g1 = r * std::sin(theta);
+	}
+
+	/*
+	/// @brief      񶥵
+	/// @details     i ȡ philox4x32({i, stream, 0, 0}, {seed, 0})  4 ǰ 3 
+	///             ̬ Box-Muller õ 4 ȡǰ 3 ǰ 2 õ 1 
+	///             ΪεȨƽڼ֮ǰɵǰλ
+	/// @param[in]  : stream : ͬһµĲͬУڼμ
+	/// @return
+	/// @attention  Ҫ񣬷ΪĶ㲻
+	*/
+	inline void addNoise(HEMeshX& mesh, NoiseType type, float scale, uint32_t seed, uint32_t stream = 0, int numThreads = 1) {
+		assert(mesh.AttributesInSync());
+		const int n = static_cast<int>(mesh.positions.size());
+		const std::array<uint32_t, 2> key = { seed, 0u };
+		if (type != NoiseType::Normal) {
+			parallelFor(n, numThreads, [&](int i) {
+				const auto r = philox4x32({ static_cast<uint32_t>(i), stream, 0u, 0u }, key);
+				Ubpa::vecf3 d;
+				if (type == NoiseType::Uniform) {
+					for (int k = 0; k < 3; ++k)
+						d[k] = 2.f * uniform01(r[k]) - 1.f;
+				}
+				else {
+					float unused;
+					boxMuller(r[0], r[1], &d[0], &d[1]);
+					boxMuller(r[2], r[3], &d[2], &unused);
+				}
+				mesh.positions[i] += scale * d;
+			});
+			return;
+		}
+
+		// ȫƶѾƶڵ
+		std::vector<Ubpa::vecf3> normals(n);
+		parallelFor(n, numThreads, [&](int i) {
+			auto* v = mesh.Vertices().at(i);
+			const Ubpa::pointf3& p = mesh.positions[i];
+			float x = 0.f, y = 0.f, z = 0.f;
+			// һȦ OutHalfEdges ÿһ
+			auto* begin = v->HalfEdge();
+			for (auto* he = begin; he; he = he->Pair()->Next() == begin ? nullptr : he->Pair()->Next()) {
+				if (!he->Polygon())
+					continue;
+				const Ubpa::vecf3 u = mesh.positions[he->Next()->Origin()->index] - p;
+				const Ubpa::vecf3 w = mesh.positions[he->Next()->Next()->Origin()->index] - p;
+				x += u[1] * w[2] - u[2] * w[1];
+				y += u[2] * w[0] - u[0] * w[2];
+				z += u[0] * w[1] - u[1] * w[0];
+			}
+			const float len = std::sqrt(x * x + y * y + z * z);
+			normals[i] = len > 0.f ? Ubpa::vecf3(x / len, y / len, z / len) : Ubpa::vecf3(0.f);
+		});
+		parallelFor(n, numThreads, [&](int i) {
+			const auto r = philox4x32({ static_cast<uint32_t>(i), stream, 0u, 0u }, key);
+			float g, unused;
+			boxMuller(r[0], r[1], &g, &unused);
+			mesh.positions[i] += (scale * g) * normals[i];
+		});
+	}
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include "MappedFile.h"
+#include "Parallel.h"
+
+#include <UGM/UGM.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**********************************************************************************
+/// @file       ObjLoader.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      OBJ Ĳжȡ
+/// @details    ļӳ䵽ڴб߽гɿ飬ÿһ̣߳
+///             һĶǰ׺͵õдλãڶ from_chars д룻
+///             Ϊƽ̵λ±飬ֱӽ buildHEMesh༭Դߣ
+///             ֻ v  fΰʷֳΣ¼vtvnogusemtl ȣ
+**********************************************************************************/
+
+namespace Geometry {
+	// ÿôֽڣ̫Сļֵÿ߳
+	constexpr size_t OBJ_MIN_CHUNK = 1 << 20;
+
+	enum class ObjError {
+		None,
+		OpenFailed,
+		BadVertex,			// v  3 
+		BadFace,			// f  3 㣬򶥵±겻
+		IndexOutOfRange		// ±Ϊ 0 򳬳
+	};
+
+	inline const char* toString(ObjError error) {
+		switch (error) {
+		case ObjError::None: return "none";
+		case ObjError::OpenFailed: return "open failed";
+		case ObjError::BadVertex: return "bad vertex";
+		case ObjError::BadFace: return "bad face";
+		case ObjError::IndexOutOfRange: return "index out of range";
+		default: return "unknown";
+		}
+	}
+
+	struct ObjLoadStats {
+		size_t bytes{ 0 };
+		int chunks{ 0 };
+		int vertices{ 0 };
+		int faces{ 0 };			// ʷֺ
+		int polygons{ 0 };		// Զ 3 ĸ
+		int errorLine{ 0 };		// һڵУ 1 ʼ
+		double mapMs{ 0.0 };
+		double countMs{ 0.0 };
+		double parseMs{ 0.0 };
+	};
+
+	namespace details {
+		enum class ObjRecord { Other, Vertex, Face };
+
+		inline bool isObjSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+		inline const char* skipObjSpace(const char* p, const char* end) {
+			while (p < end && isObjSpace(*p))
+				++p;
+			return p;
+		}
+
+		// ׿հףؼ¼ͣp Ƶؼ֮
+		inline ObjRecord objRecord(const char*& p, const char* end) {
+			p = skipObjSpace(p, end);
+			if (end - p >= 2 && isObjSpace(p[1])) {
+				if (p[0] == 'v') {
+					p += 2;
+					return ObjRecord::Vertex;
+				}
+				if (p[0] == 'f') {
+					p += 2;
+					return ObjRecord::Face;
+				}
+			}
+			return ObjRecord::Other;
+		}
+
+		// հ׷ָļ¼
+		inline int objTokenCount(const char* p, const char* end) {
+			int count = 0;
+			for (p = skipObjSpace(p, end); p < end; p = skipObjSpace(p, end)) {
+				++count;
+				while (p < end && !isObjSpace(*p))
+					++p;
+			}
+			return count;
+		}
+
+		struct ObjChunk {
+			size_t begin{ 0 }, end{ 0 };
+			int lines{ 0 };
+			int vertices{ 0 };
+			int faces{ 0 };
+			int polygons{ 0 };
+			ObjError error{ ObjError::None };
+			int errorLine{ 0 };		// ڵкţ 0 ʼ
+		};
+	}
+
+	/*
+	/// @brief      ȡ OBJ Ķλ
+	/// @details    ±֧ vv/vtv/vt/vnv//vn 븺ڸ֮ǰĶ
+	///             k  (i_0, ..., i_{k-1}) ʷΪ (i_0, i_{j}, i_{j+1})j = 1..k-2
+	/// @param[in]  :
+	/// @return     һλãļ˳򣩵Ĵк stats->errorLine
+	/// @attention  ʱ positions  indices 
+	*/
+	inline ObjError loadObj(const std::string& path, std::vector<Ubpa::pointf3>* positions, std::vector<uint32_t>* indices,
+		int numThreads = 1, ObjLoadStats* stats = nullptr)
+	{
+		using namespace details;
+		ObjLoadStats localStats;
+		if (!stats)
+			stats = &localStats;
+		*stats = ObjLoadStats();
+
+		auto t0 = std::chrono::high_resolution_clock::now();
+		MappedFile file;
+		if (!file.Open(path))
+			return ObjError::OpenFailed;
+		const char* data = file.Data();
+		const size_t bytes = file.Size();
+		stats->bytes = bytes;
+		auto t1 = std::chrono::high_resolution_clock::now();
+		stats->mapMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+		// ı߽Ƶһе
+		const int chunks = static_cast<int>(std::max<size_t>(1, std::min<size_t>(numThreads, bytes / OBJ_MIN_CHUNK)));
+		stats->chunks = chunks;
+		std::vector<ObjChunk> chunk(chunks);
+		for (int c = 0; c < chunks; ++c) {
+			size_t begin = bytes / chunks * c;
+			while (begin > 0 && begin < bytes && data[begin - 1] != '\n')
+				++begin;
+			chunk[c].begin = begin;
+			if (c > 0)
+				chunk[c - 1].end = begin;
+		}
+		chunk[chunks - 1].end = bytes;
+
+		// һ飺
+		parallelTasks(chunks, [&](int c) {
+			ObjChunk& ck = chunk[c];
+			const char* end = data + ck.end;
+			for (const char* line = data + ck.begin; line < end; ++ck.lines) {
+				const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+				if (!lineEnd)
+					lineEnd = end;
+				const char* p = line;
+				switch (objRecord(p, lineEnd)) {
+				case ObjRecord::Vertex:
+					++ck.vertices;
+					break;
+				case ObjRecord::Face: {
+					const int k = objTokenCount(p, lineEnd);
+					if (k >= 3) {
+						ck.faces += k - 2;
+						ck.polygons += k > 3 ? 1 : 0;
+					}
+					break;
+				}
+				default:
+					break;
+				}
+				line = lineEnd + 1;
+			}
+		});
+		std::vector<int> vertexOffset(chunks + 1, 0), faceOffset(chunks + 1, 0), lineOffset(chunks + 1, 0);
+		for (int c = 0; c < chunks; ++c) {
+			vertexOffset[c + 1] = vertexOffset[c] + chunk[c].vertices;
+			faceOffset[c + 1] = faceOffset[c] + chunk[c].faces;
+			lineOffset[c + 1] = lineOffset[c] + chunk[c].lines;
+			stats->polygons += chunk[c].polygons;
+		}
+		const int numVertices = vertexOffset[chunks];
+		const int numFaces = faceOffset[chunks];
+		stats->vertices = numVertices;
+		stats->faces = numFaces;
+		positions->resize(numVertices);
+		indices->resize(3 * static_cast<size_t>(numFaces));
+		auto t2 = std::chrono::high_resolution_clock::now();
+		stats->countMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+		// ڶ飺дԼ
+		parallelTasks(chunks, [&](int c) {
+			ObjChunk& ck = chunk[c];
+			const char* end = data + ck.end;
+			Ubpa::pointf3* pos = positions->data() + vertexOffset[c];
+			uint32_t* idx = indices->data() + 3 * static_cast<size_t>(faceOffset[c]);
+			int vertexCount = vertexOffset[c];		// ǰ֮ǰĶ±
+			std::vector<uint32_t> polygon;
+			auto fail = [&](ObjError error, int line) {
+				ck.error = error;
+				ck.errorLine = line;
+			};
+			int lineIndex = 0;
+			for (const char* line = data + ck.begin; line < end && ck.error == ObjError::None; ++lineIndex) {
+				const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+				if (!lineEnd)
+					lineEnd = end;
+				const char* p = line;
+				const ObjRecord record = objRecord(p, lineEnd);
+				if (record == ObjRecord::Vertex) {
+					Ubpa::pointf3& v = *pos++;
+					for (int k = 0; k < 3; ++k) {
+						p = skipObjSpace(p, lineEnd);
+						auto result = std::from_chars(p, lineEnd, v[k]);
+						if (result.ec != std::errc()) {
+							fail(ObjError::BadVertex, lineIndex);
+							break;
+						}
+						p = result.ptr;
+					}
+					++vertexCount;
+				}
+				else if (record == ObjRecord::Face) {
+					polygon.clear();
+					for (p = skipObjSpace(p, lineEnd); p < lineEnd; p = skipObjSpace(p, lineEnd)) {
+						long long i = 0;
+						auto result = std::from_chars(p, lineEnd, i);
+						if (result.ec != std::errc()) {
+							fail(ObjError::BadFace, lineIndex);
+							break;
+						}
+						//  /vt/vn
+						p = result.ptr;
+						while (p < lineEnd && !isObjSpace(*p))
+							++p;
+						const long long v = i > 0 ? i - 1 : vertexCount + i;
+						if (i == 0 || v < 0 || v >= numVertices) {
+							fail(ObjError::IndexOutOfRange, lineIndex);
+							break;
+						}
+						polygon.push_back(static_cast<uint32_t>(v));
+					}
+					if (ck.error == ObjError::None && polygon.size() < 3)
+						fail(ObjError::BadFace, lineIndex);
+					for (size_t j = 1; ck.error == ObjError::None && j + 1 < polygon.size(); ++j) {
+						*idx++ = polygon[0];
+						*idx++ = polygon[j];
+						*idx++ = polygon[j + 1];
+					}
+				}
+				line = lineEnd + 1;
+			}
+		});
+		auto t3 = std::chrono::high_resolution_clock::now();
+		stats->parseMs = std::chrono::duration<double, std::milli>(t3 - t2).count();
+
+		for (int c = 0; c < chunks; ++c) {
+			if (chunk[c].error != ObjError::None) {
+				stats->errorLine = lineOffset[c] + chunk[c].errorLine + 1;
+				return chunk[c].error;
+			}
+		}
+		return ObjError::None;
+	}
+}
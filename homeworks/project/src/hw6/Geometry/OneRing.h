@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../HEMeshX.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+/**********************************************************************************
+/// @file       OneRing.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      һ CSR ʾ
+/// @details    Ӱ߽ṹһΣ±ÿڵţ
+///             ͬʱÿεĶԶ߽ǣ֮ĵֻЩ飬ٷʰ
+**********************************************************************************/
+
+namespace Geometry {
+	enum class Weighting { Uniform, Cotangent };
+
+	// (b - o)  (c - o) нǵ
+	inline float cotangent(const Ubpa::pointf3& o, const Ubpa::pointf3& b, const Ubpa::pointf3& c) {
+		const float ux = b[0] - o[0], uy = b[1] - o[1], uz = b[2] - o[2];
+		const float vx = c[0] - o[0], vy = c[1] - o[1], vz = c[2] - o[2];
+		const float dot = ux * vx + uy * vy + uz * vz;
+		const float cx = uy * vz - uz * vy, cy = uz * vx - ux * vz, cz = ux * vy - uy * vx;
+		const float cross = sqrtf(cx * cx + cy * cy + cz * cz);
+		return cross > 1e-20f ? dot / cross : 0.0f;
+	}
+
+	struct OneRing {
+		std::vector<int> offsets;		//  i ڵΪ neighbors[offsets[i], offsets[i+1])
+		std::vector<int> neighbors;
+		std::vector<int> left, right;	//  i->j εĶԶ㣬ûʱΪ -1
+		std::vector<char> boundary;		// ߽綥Ϊ 1
+
+		int NumVertices() const { return static_cast<int>(boundary.size()); }
+
+		/*
+		/// @brief      Ӱ߽ṹ CSR ڽ
+		/// @details     i ĳ he ָ jhe εĵ࣬ԱεĵҲ
+		/// @param[in]  :
+		/// @return
+		/// @attention  Ҫ񣻹ûڵ
+		*/
+		void Build(HEMeshX& mesh) {
+			assert(mesh.AttributesInSync());
+			const int n = static_cast<int>(mesh.Vertices().size());
+			offsets.assign(n + 1, 0);
+			boundary = mesh.Boundary().onBoundary;
+			neighbors.clear();
+			left.clear();
+			right.clear();
+			neighbors.reserve(mesh.HalfEdges().size());
+			left.reserve(mesh.HalfEdges().size());
+			right.reserve(mesh.HalfEdges().size());
+			for (int i = 0; i < n; ++i) {
+				auto* v = mesh.Vertices().at(i);
+				if (!v->IsIsolated()) {
+					for (auto* he : v->OutHalfEdges()) {
+						neighbors.push_back(he->End()->index);
+						left.push_back(he->Polygon() ? he->Next()->End()->index : -1);
+						auto* pair = he->Pair();
+						right.push_back(pair->Polygon() ? pair->Next()->End()->index : -1);
+					}
+				}
+				offsets[i + 1] = static_cast<int>(neighbors.size());
+			}
+		}
+
+		/*
+		/// @brief      ÿڱߵȨ
+		/// @details    ȨΪ 1ȨΪ (cot a + cot b) / 2ֵΪ 0 Ա֤ Jacobi ͹
+		/// @param[in]  : positions : ±еλ
+		/// @return
+		/// @attention  weights  neighbors һһӦ
+		*/
+		void Weights(Weighting weighting, const std::vector<Ubpa::pointf3>& positions, std::vector<float>* weights, int numThreads = 1) const {
+			weights->resize(neighbors.size());
+			float* w = weights->data();
+			if (weighting == Weighting::Uniform) {
+				std::fill(weights->begin(), weights->end(), 1.0f);
+				return;
+			}
+			const Ubpa::pointf3* p = positions.data();
+			parallelFor(NumVertices(), numThreads, [&](int i) {
+				for (int e = offsets[i]; e < offsets[i + 1]; ++e) {
+					const int j = neighbors[e];
+					float cot = 0.0f;
+					if (left[e] >= 0)
+						cot += cotangent(p[left[e]], p[i], p[j]);
+					if (right[e] >= 0)
+						cot += cotangent(p[right[e]], p[i], p[j]);
+					w[e] = std::max(0.5f * cot, 0.0f);
+				}
+			});
+		}
+	};
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**********************************************************************************
+/// @file       Parallel.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ϵķֿ鲢
+/// @details     [0, n) ±ֳĿ飬ÿһ̣߳˳ִУ
+///             ÿдصλãҪԼŸһɵߺϲ
+**********************************************************************************/
+
+namespace Geometry {
+	// ÿôԪأ̫СĿ鲻ֵÿ߳
+	constexpr int PARALLEL_MIN_CHUNK = 1 << 12;
+
+	inline int hardwareThreads() {
+		unsigned n = std::thread::hardware_concurrency();
+		return n > 0 ? static_cast<int>(n) : 1;
+	}
+
+	// ʵʷֳɵĿ
+	inline int chunkCount(int n, int numThreads) {
+		return std::max(1, std::min(numThreads, n / PARALLEL_MIN_CHUNK));
+	}
+
+	/*
+	/// @brief       [0, n) ֳ chunkCount(n, numThreads) 鲢ִ f(chunk, begin, end)
+	/// @details     0 ڵִ߳УĻֻ n 
+	/// @param[in]  :
+	/// @return
+	/// @attention  f ĸεֻдصλ
+	*/
+	template<typename Fun>
+	inline void parallelChunks(int n, int numThreads, Fun&& f) {
+		const int chunks = chunkCount(n, numThreads);
+		auto bound = [=](int c) { return static_cast<int>(static_cast<long long>(n) * c / chunks); };
+		if (chunks == 1) {
+			f(0, 0, n);
+			return;
+		}
+		std::vector<std::thread> workers;
+		workers.reserve(chunks - 1);
+		for (int c = 1; c < chunks; ++c)
+			workers.emplace_back([&f, c, begin = bound(c), end = bound(c + 1)]() { f(c, begin, end); });
+		f(0, 0, bound(1));
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+	// Ԫز
+	template<typename Fun>
+	inline void parallelFor(int n, int numThreads, Fun&& f) {
+		parallelChunks(n, numThreads, [&f](int, int begin, int end) {
+			for (int i = begin; i < end; ++i)
+				f(i);
+		});
+	}
+
+	/*
+	/// @brief      ÿһִ߳ f(task)task ȡ [0, count)
+	/// @details    ڵԼֺõĴļгɵĿ飻 0 ڵִ߳
+	/// @param[in]  :
+	/// @return
+	/// @attention  f ĸεֻдصλ
+	*/
+	template<typename Fun>
+	inline void parallelTasks(int count, Fun&& f) {
+		std::vector<std::thread> workers;
+		workers.reserve(std::max(count - 1, 0));
+		for (int task = 1; task < count; ++task)
+			workers.emplace_back([&f, task]() { f(task); });
+		if (count > 0)
+			f(0);
+		for (auto& worker : workers)
+			worker.join();
+	}
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**********************************************************************************
+/// @file       Topology.h
+/// @author     Qingjun Chang
+/// @date       2026.10.19
+/// @brief      ±ʾ߽ṹ
+/// @details     f Ϊ 3f, 3f+1, 3f+2߽ΰ֮
+///             ʱ԰ߵ (min, max) Ϊ򣺽С˵һ˼Ͱٰϴ˵
+///             ͬڣʱɣҪ߲ϣͬʱαߡһζ
+**********************************************************************************/
+
+namespace Geometry {
+	// ôͰò򣬸Ͱ߶㣩 std::sort O(d^2)
+	constexpr int TOPOLOGY_INSERTION_SORT_MAX = 16;
+
+	struct Topology {
+		int numVertices{ 0 };
+		int numFaces{ 0 };
+		std::vector<int> next;
+		std::vector<int> pair;
+		std::vector<int> origin;
+		std::vector<int> face;				// ߽Ϊ -1
+		std::vector<int> vertexHalfEdge;	// һߣ߽綥ȡ߽ߣΪ -1
+
+		int NumHalfEdges() const { return static_cast<int>(origin.size()); }
+		int NumInteriorHalfEdges() const { return 3 * numFaces; }
+		bool IsBoundary(int h) const { return h >= 3 * numFaces; }
+		int End(int h) const { return origin[next[h]]; }
+	};
+
+	enum class TopologyError { None, BadIndex, DegenerateFace, NonManifoldEdge, InconsistentOrientation, NonManifoldVertex };
+
+	inline const char* toString(TopologyError error) {
+		switch (error) {
+		case TopologyError::None: return "none";
+		case TopologyError::BadIndex: return "index out of range";
+		case TopologyError::DegenerateFace: return "face with repeated vertices";
+		case TopologyError::NonManifoldEdge: return "edge shared by more than two faces";
+		case TopologyError::InconsistentOrientation: return "adjacent faces with inconsistent orientation";
+		default: return "non-manifold vertex";
+		}
+	}
+
+	/*
+	/// @brief      ζ±꽨߽ṹ
+	/// @details    1. ԽС˵Ϊһ˼ÿһͰͰڰϴ˵ͰСԼΪĶȣСͰ򣬴Ͱ std::sort
+	///             2. Ͱͬ (min, max) ڣһΪ߽ߣ뷽෴Ϊαߣ
+	///             3. ÿδԵİ߲һı߽ߣ߽ߵ next Ϊյı߽ߣ
+	///             4. ÿתһܣĳڸõĳ
+	///             ͰأͰ붥鰴㲢У߳޹
+	/// @param[in]  : indices : 3 * numFaces ±    numVertices : δõĶ
+	/// @return     ʧԭ򣬳ɹΪ TopologyError::None
+	/// @attention
+	*/
+	inline TopologyError buildTopology(const uint32_t* indices, int numFaces, int numVertices, Topology* topo, int numThreads = 1) {
+		const int numInterior = 3 * numFaces;
+		topo->numVertices = numVertices;
+		topo->numFaces = numFaces;
+		std::atomic<int> error{ static_cast<int>(TopologyError::None) };
+		auto fail = [&](TopologyError e) { error.store(static_cast<int>(e), std::memory_order_relaxed); };
+		auto endOf = [&](int h) { return indices[h - h % 3 + (h % 3 + 1) % 3]; };
+
+		parallelFor(numFaces, numThreads, [&](int f) {
+			const uint32_t a = indices[3 * f], b = indices[3 * f + 1], c = indices[3 * f + 2];
+			if (a >= static_cast<uint32_t>(numVertices) || b >= static_cast<uint32_t>(numVertices) || c >= static_cast<uint32_t>(numVertices))
+				fail(TopologyError::BadIndex);
+			else if (a == b || b == c || c == a)
+				fail(TopologyError::DegenerateFace);
+		});
+		if (error != static_cast<int>(TopologyError::None))
+			return static_cast<TopologyError>(error.load());
+
+		// С˵ͰͰڱְ±˳
+		std::vector<int> offsets(numVertices + 1, 0);
+		for (int h = 0; h < numInterior; ++h)
+			++offsets[std::min(indices[h], endOf(h)) + 1];
+		for (int v = 0; v < numVertices; ++v)
+			offsets[v + 1] += offsets[v];
+		std::vector<int> sorted(numInterior);
+		{
+			std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+			for (int h = 0; h < numInterior; ++h)
+				sorted[cursor[std::min(indices[h], endOf(h))]++] = h;
+		}
+
+		// Ͱڰϴ˵ԣÿͰδԵİ
+		std::vector<int>& pair = topo->pair;
+		pair.assign(numInterior, -1);
+		std::vector<int> boundaryCount(numVertices + 1, 0);
+		parallelFor(numVertices, numThreads, [&](int v) {
+			int* bucket = sorted.data() + offsets[v];
+			const int size = offsets[v + 1] - offsets[v];
+			auto key = [&](int h) { return std::max(indices[h], endOf(h)); };
+			if (size > TOPOLOGY_INSERTION_SORT_MAX) {
+				// ͬʱ±꣬Ľһ
+				std::sort(bucket, bucket + size, [&](int a, int b) {
+					const uint32_t ka = key(a), kb = key(b);
+					return ka < kb || (ka == kb && a < b);
+				});
+			}
+			else {
+				for (int i = 1; i < size; ++i) {
+					const int h = bucket[i];
+					const uint32_t k = key(h);
+					int j = i;
+					for (; j > 0 && key(bucket[j - 1]) > k; --j)
+						bucket[j] = bucket[j - 1];
+					bucket[j] = h;
+				}
+			}
+			for (int i = 0; i < size;) {
+				int j = i + 1;
+				while (j < size && key(bucket[j]) == key(bucket[i]))
+					++j;
+				if (j - i > 2)
+					fail(TopologyError::NonManifoldEdge);
+				else if (j - i == 2) {
+					const int h0 = bucket[i], h1 = bucket[i + 1];
+					if (indices[h0] == indices[h1])
+						fail(TopologyError::InconsistentOrientation);
+					pair[h0] = h1;
+					pair[h1] = h0;
+				}
+				else
+					++boundaryCount[v + 1];
+				i = j;
+			}
+		});
+		if (error != static_cast<int>(TopologyError::None))
+			return static_cast<TopologyError>(error.load());
+		for (int v = 0; v < numVertices; ++v)
+			boundaryCount[v + 1] += boundaryCount[v];
+
+		const int numBoundary = boundaryCount[numVertices];
+		const int numHalfEdges = numInterior + numBoundary;
+		pair.resize(numHalfEdges);
+		topo->origin.resize(numHalfEdges);
+		topo->next.resize(numHalfEdges);
+		topo->face.resize(numHalfEdges);
+		parallelFor(numInterior, numThreads, [&](int h) {
+			topo->origin[h] = static_cast<int>(indices[h]);
+			topo->next[h] = h - h % 3 + (h % 3 + 1) % 3;
+			topo->face[h] = h / 3;
+		});
+		// ߽߰Ͱ˳
+		parallelFor(numVertices, numThreads, [&](int v) {
+			int b = numInterior + boundaryCount[v];
+			for (int i = offsets[v]; i < offsets[v + 1]; ++i) {
+				const int h = sorted[i];
+				if (pair[h] >= 0)
+					continue;
+				pair[h] = b;
+				pair[b] = h;
+				topo->origin[b] = static_cast<int>(endOf(h));
+				topo->face[b] = -1;
+				++b;
+			}
+		});
+		std::vector<int> boundaryOut(numVertices, -1);
+		for (int b = numInterior; b < numHalfEdges; ++b) {
+			// һı߽߶һʱ㴦ж
+			int& out = boundaryOut[topo->origin[b]];
+			if (out >= 0)
+				return TopologyError::NonManifoldVertex;
+			out = b;
+		}
+		for (int b = numInterior; b < numHalfEdges; ++b)
+			topo->next[b] = boundaryOut[topo->origin[pair[b]]];
+
+		// ÿĳһ
+		std::vector<int> degree(numVertices, 0);
+		topo->vertexHalfEdge.assign(numVertices, -1);
+		for (int h = 0; h < numHalfEdges; ++h) {
+			const int v = topo->origin[h];
+			++degree[v];
+			if (topo->vertexHalfEdge[v] < 0)
+				topo->vertexHalfEdge[v] = h;
+		}
+		parallelFor(numVertices, numThreads, [&](int v) {
+			if (boundaryOut[v] >= 0)
+				topo->vertexHalfEdge[v] = boundaryOut[v];
+			const int start = topo->vertexHalfEdge[v];
+			if (start < 0)
+				return;
+			int count = 0, h = start;
+			do {
+				h = topo->next[pair[h]];
+				++count;
+			} while (h != start && count <= degree[v]);
+			if (count != degree[v])
+				fail(TopologyError::NonManifoldVertex);
+		});
+		return static_cast<TopologyError>(error.load());
+	}
+}
@@ -4,6 +4,13 @@
 
 #include <UGM/UGM.h>
 
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
 struct Vertex;
 struct Edge;
 struct Triangle;
@@ -13,7 +20,9 @@ using HEMeshXTraits = Ubpa::HEMeshTraits<Vertex, Edge, Triangle, HalfEdge>;
 
 struct Vertex : Ubpa::TVertex<HEMeshXTraits> {
 	// you can add any attributes and mothods to Vertex
-	Ubpa::pointf3 position{ 0.f };
+
+	// index in HEMeshX::Vertices() and in the attribute arrays of HEMeshX, kept up to date by HEMeshX
+	int index{ -1 };
 };
 
 struct Edge : Ubpa::TEdge<HEMeshXTraits> {
@@ -55,6 +64,262 @@ struct HalfEdge : Ubpa::THalfEdge<HEMeshXTraits> {
 
 };
 
+// boundary loops as ordered arrays, loop k is vertices[offsets[k], offsets[k+1]),
+// halfEdges[i] is the boundary half-edge from vertices[i] to the next vertex of the loop
+struct BoundaryLoops {
+	std::vector<int> offsets{ 0 };
+	std::vector<int> vertices;
+	std::vector<HalfEdge*> halfEdges;
+	std::vector<char> onBoundary;	// per vertex index
+
+	int NumLoops() const { return static_cast<int>(offsets.size()) - 1; }
+	int Size(int loop) const { return offsets[loop + 1] - offsets[loop]; }
+	bool IsBoundary(int vertex) const { return onBoundary[vertex] != 0; }
+};
+
 struct HEMeshX : Ubpa::HEMesh<HEMeshXTraits> {
 	// you can add any attributes and mothods to HEMeshX
+
+	// vertex attributes are stored as arrays indexed by Vertex::index,
+	// so whole-mesh kernels run over contiguous memory while the half-edges keep the connectivity
+	std::vector<Ubpa::pointf3> positions;
+	std::vector<Ubpa::normalf> normals;
+	std::unordered_map<std::string, std::vector<float>> scalars;
+
+	Ubpa::pointf3& Position(Vertex* v) {
+		assert(v->index >= 0 && v->index < static_cast<int>(positions.size()));
+		return positions[v->index];
+	}
+
+	// every vertex sits at its index and has a slot in the attribute arrays, O(V), kernels assert it in debug builds
+	bool AttributesInSync() {
+		const int n = static_cast<int>(Vertices().size());
+		if (static_cast<int>(positions.size()) != n || static_cast<int>(normals.size()) != n)
+			return false;
+		for (const auto& [name, values] : scalars) {
+			if (static_cast<int>(values.size()) != n)
+				return false;
+		}
+		for (int i = 0; i < n; ++i) {
+			if (Vertices().at(i)->index != i)
+				return false;
+		}
+		return true;
+	}
+
+	// increased by every topology change made through HEMeshX (the Euler operations below shadow the base ones),
+	// caches built from the connectivity compare it; edits through the base type need SyncAttributes()
+	size_t TopologyVersion() const { return topologyVersion; }
+
+	// built on first use after a topology change, O(E) once instead of on every query
+	const BoundaryLoops& Boundary() {
+		if (boundaryVersion != topologyVersion || boundary.onBoundary.size() != Vertices().size())
+			BuildBoundary();
+		return boundary;
+	}
+
+	// user attribute, created with zeros on first use
+	std::vector<float>& Scalars(const std::string& name) {
+		auto& values = scalars[name];
+		values.resize(positions.size(), 0.f);
+		return values;
+	}
+
+	void Reserve(size_t n) {
+		Ubpa::HEMesh<HEMeshXTraits>::Reserve(n);
+		positions.reserve(n);
+		normals.reserve(n);
+	}
+
+	Vertex* AddVertex() {
+		Vertex* v = Ubpa::HEMesh<HEMeshXTraits>::AddVertex();
+		++topologyVersion;
+		v->index = static_cast<int>(positions.size());
+		positions.emplace_back(0.f, 0.f, 0.f);
+		normals.emplace_back(0.f, 0.f, 0.f);
+		for (auto& [name, values] : scalars)
+			values.push_back(0.f);
+		return v;
+	}
+
+	bool Init(const std::vector<size_t>& polygons, size_t sides) {
+		Clear();
+		bool success = Ubpa::HEMesh<HEMeshXTraits>::Init(polygons, sides);
+		SyncAttributes();
+		return success;
+	}
+
+	void Clear() {
+		Ubpa::HEMesh<HEMeshXTraits>::Clear();
+		++topologyVersion;
+		positions.clear();
+		normals.clear();
+		for (auto& [name, values] : scalars)
+			values.clear();
+	}
+
+	// Euler operations, each one invalidates the caches built from the connectivity
+
+	template<typename... Args>
+	Edge* AddEdge(Vertex* v0, Vertex* v1, Args&&... args) {
+		Edge* e = Ubpa::HEMesh<HEMeshXTraits>::AddEdge(v0, v1, std::forward<Args>(args)...);
+		++topologyVersion;
+		return e;
+	}
+
+	template<typename... Args>
+	Triangle* AddPolygon(const std::vector<HalfEdge*>& heLoop, Args&&... args) {
+		Triangle* p = Ubpa::HEMesh<HEMeshXTraits>::AddPolygon(heLoop, std::forward<Args>(args)...);
+		++topologyVersion;
+		return p;
+	}
+
+	void RemovePolygon(Triangle* p) {
+		Ubpa::HEMesh<HEMeshXTraits>::RemovePolygon(p);
+		++topologyVersion;
+	}
+
+	void RemoveEdge(Edge* e) {
+		const int i0 = e->HalfEdge()->Origin()->index, i1 = e->HalfEdge()->Pair()->Origin()->index;
+		Ubpa::HEMesh<HEMeshXTraits>::RemoveEdge(e);
+		SyncVertexSlots({ i0, i1 });
+	}
+
+	void RemoveVertex(Vertex* v) {
+		const int i = v->index;
+		Ubpa::HEMesh<HEMeshXTraits>::RemoveVertex(v);
+		SyncVertexSlots({ i });
+	}
+
+	template<typename... Args>
+	Vertex* AddEdgeVertex(Edge* e, Args&&... args) {
+		Vertex* v = Ubpa::HEMesh<HEMeshXTraits>::AddEdgeVertex(e, std::forward<Args>(args)...);
+		SyncVertexSlots({});
+		return v;
+	}
+
+	template<typename... Args>
+	Edge* ConnectVertex(HalfEdge* he0, HalfEdge* he1, Args&&... args) {
+		Edge* e = Ubpa::HEMesh<HEMeshXTraits>::ConnectVertex(he0, he1, std::forward<Args>(args)...);
+		++topologyVersion;
+		return e;
+	}
+
+	bool FlipEdge(Edge* e) {
+		bool success = Ubpa::HEMesh<HEMeshXTraits>::FlipEdge(e);
+		++topologyVersion;
+		return success;
+	}
+
+	Vertex* SpiltEdge(Edge* e) {
+		Vertex* v = Ubpa::HEMesh<HEMeshXTraits>::SpiltEdge(e);
+		SyncVertexSlots({});
+		return v;
+	}
+
+	Vertex* CollapseEdge(Edge* e) {
+		const int i0 = e->HalfEdge()->Origin()->index, i1 = e->HalfEdge()->Pair()->Origin()->index;
+		Vertex* v = Ubpa::HEMesh<HEMeshXTraits>::CollapseEdge(e);
+		SyncVertexSlots({ i0, i1 });
+		return v;
+	}
+
+	// call after editing through the base type, attributes follow their vertices to the new indices and caches are invalidated
+	void SyncAttributes() {
+		++topologyVersion;
+		const int n = static_cast<int>(Vertices().size());
+		bool ordered = static_cast<int>(positions.size()) == n;
+		for (int i = 0; i < n && ordered; ++i)
+			ordered = Vertices().at(i)->index == i;
+		if (ordered)
+			return;
+		const int old = static_cast<int>(positions.size());
+		std::vector<int> from(n);
+		for (int i = 0; i < n; ++i) {
+			Vertex* v = Vertices().at(i);
+			from[i] = v->index >= 0 && v->index < old ? v->index : -1;
+			v->index = i;
+		}
+		positions = gather(positions, from, Ubpa::pointf3(0.f, 0.f, 0.f));
+		normals = gather(normals, from, Ubpa::normalf(0.f, 0.f, 0.f));
+		for (auto& [name, values] : scalars)
+			values = gather(values, from, 0.f);
+	}
+
+private:
+	void BuildBoundary() {
+		const int n = static_cast<int>(Vertices().size());
+		boundary.offsets.assign(1, 0);
+		boundary.vertices.clear();
+		boundary.halfEdges.clear();
+		boundary.onBoundary.assign(n, 0);
+		for (HalfEdge* he : HalfEdges()) {
+			if (he->Polygon() || boundary.onBoundary[he->Origin()->index])
+				continue;
+			HalfEdge* cur = he;
+			do {
+				boundary.onBoundary[cur->Origin()->index] = 1;
+				boundary.vertices.push_back(cur->Origin()->index);
+				boundary.halfEdges.push_back(cur);
+				cur = cur->Next();
+			} while (cur != he);
+			boundary.offsets.push_back(static_cast<int>(boundary.vertices.size()));
+		}
+		boundaryVersion = topologyVersion;
+	}
+
+	// after a base operation that added or removed vertices, O(1): Vertices() stays dense by moving the last vertex
+	// into a removed slot and appends new vertices at the end, so only the given slots (of the vertices that may have
+	// been removed) and the last slots can hold a vertex with a stale index; attributes follow their vertices,
+	// new vertices get zeros
+	void SyncVertexSlots(std::vector<int> slots) {
+		++topologyVersion;
+		const int n = static_cast<int>(Vertices().size());
+		const int old = static_cast<int>(positions.size());
+		for (int s = std::max(0, std::min(old, n) - static_cast<int>(slots.size())); s < n; ++s)
+			slots.push_back(s);
+		std::sort(slots.begin(), slots.end());
+		slots.erase(std::unique(slots.begin(), slots.end()), slots.end());
+		std::vector<std::pair<int, int>> moves;	// (new index, old index or -1)
+		for (int s : slots) {
+			if (s < 0 || s >= n)
+				continue;
+			const int from = Vertices().at(s)->index;
+			if (from != s)
+				moves.emplace_back(s, from >= 0 && from < old ? from : -1);
+		}
+		move(positions, moves, n, Ubpa::pointf3(0.f, 0.f, 0.f));
+		move(normals, moves, n, Ubpa::normalf(0.f, 0.f, 0.f));
+		for (auto& [name, values] : scalars)
+			move(values, moves, n, 0.f);
+		for (const auto& [to, from] : moves)
+			Vertices().at(to)->index = to;
+	}
+
+	size_t topologyVersion{ 0 };
+	size_t boundaryVersion{ static_cast<size_t>(-1) };
+	BoundaryLoops boundary;
+
+	// all sources are read before any slot is written, a moved vertex may come from a slot that is written too
+	template<typename T>
+	static void move(std::vector<T>& values, const std::vector<std::pair<int, int>>& moves, int n, const T& init) {
+		std::vector<T> moved;
+		moved.reserve(moves.size());
+		for (const auto& [to, from] : moves)
+			moved.push_back(from >= 0 && from < static_cast<int>(values.size()) ? values[from] : init);
+		values.resize(std::max(values.size(), static_cast<size_t>(n)), init);
+		for (size_t k = 0; k < moves.size(); ++k)
+			values[moves[k].first] = moved[k];
+		values.resize(n, init);
+	}
+
+	template<typename T>
+	static std::vector<T> gather(const std::vector<T>& values, const std::vector<int>& from, const T& init) {
+		std::vector<T> result(from.size(), init);
+		for (size_t i = 0; i < from.size(); ++i) {
+			if (from[i] >= 0 && from[i] < static_cast<int>(values.size()))
+				result[i] = values[from[i]];
+		}
+		return result;
+	}
 };
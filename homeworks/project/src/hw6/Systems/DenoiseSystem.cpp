@@ -1,13 +1,93 @@
 #include "DenoiseSystem.h"
 
 #include "../Components/DenoiseData.h"
+#include "../Geometry/BilateralDenoise.h"
+#include "../Geometry/HEMeshCache.h"
+#include "../Geometry/HEMeshBuilder.h"
+#include "../Geometry/Laplacian.h"
+#include "../Geometry/MeanCurvatureFlow.h"
+#include "../Geometry/MeshExport.h"
+#include "../Geometry/MinSurf.h"
+#include "../Geometry/MinSurfGlobal.h"
+#include "../Geometry/Noise.h"
+#include "../Geometry/ObjLoader.h"
+#include "../../common/ImGuiFileBrowser/ImGuiFileBrowser.h"
 
 #include <_deps/imgui/imgui.h>
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
 using namespace Ubpa;
 
+// the factorization is kept until the topology version of the mesh changes, so solving again after moving the boundary only back-substitutes
+Geometry::GlobalMinSurf globalMinSurf;
+// face neighborhoods of the bilateral filter, rebuilt when the topology version or the neighborhood kind changes
+Geometry::BilateralDenoise bilateralDenoise;
+// Laplacian, symbolic factorization and the last numeric factorization of the implicit flow, kept across steps and clicks
+Geometry::MeanCurvatureFlow meanCurvatureFlow;
+// index buffer and vertex-face adjacency of the last export, rebuilt when the topology version changes
+Geometry::MeshExporter meshExporter;
+// how many times noise was added since the mesh was loaded, so the k-th click gives the same noise in every run
+uint32_t noiseStream = 0;
+
+imgui_addons::ImGuiFileBrowser file_dialog;
+
+// converts a grid of about 10^6 triangles with HEMesh::Init, with the index-based builder and through the binary cache,
+// then builds its cotangent Laplacian and updates it after moving a few vertices, and logs the timings
+void benchmark() {
+	const int n = 708;
+	std::vector<uint32_t> indices;
+	indices.reserve(6 * (n - 1) * (n - 1));
+	for (int y = 0; y + 1 < n; ++y) {
+		for (int x = 0; x + 1 < n; ++x) {
+			uint32_t a = y * n + x, b = a + 1, c = a + n, d = c + 1;
+			indices.insert(indices.end(), { a, b, d, a, d, c });
+		}
+	}
+	std::vector<pointf3> positions(n * n);
+	for (int i = 0; i < n * n; ++i)
+		positions[i] = pointf3(static_cast<float>(i % n), static_cast<float>(i / n), 0.f);
+
+	HEMeshX heMesh;
+	auto t0 = std::chrono::high_resolution_clock::now();
+	heMesh.Init(std::vector<size_t>(indices.begin(), indices.end()), 3);
+	heMesh.positions = positions;
+	auto t1 = std::chrono::high_resolution_clock::now();
+	spdlog::info("HEMesh::Init: {} triangles, {:.1f} ms", heMesh.Polygons().size(), std::chrono::duration<double, std::milli>(t1 - t0).count());
+
+	Geometry::HEMeshBuildStats stats;
+	Geometry::Topology topo;
+	auto error = Geometry::buildHEMesh(indices, positions, heMesh, Geometry::hardwareThreads(), &stats, &topo);
+	spdlog::info("builder ({}): {} triangles, {} boundary half-edges, topology {:.1f} ms, elements {:.1f} ms",
+		Geometry::toString(error), stats.faces, stats.boundaryHalfEdges, stats.topologyMs, stats.elementsMs);
+
+	const std::string cachePath = (std::filesystem::temp_directory_path() / "hw6_benchmark.hemesh").string();
+	const uint64_t source = Geometry::checksum64(indices.data(), indices.size() * sizeof(uint32_t), Geometry::hardwareThreads());
+	auto t2 = std::chrono::high_resolution_clock::now();
+	bool saved = Geometry::saveHEMeshCache(cachePath, topo, heMesh, source, Geometry::hardwareThreads());
+	auto t3 = std::chrono::high_resolution_clock::now();
+	Geometry::HEMeshCacheStats cacheStats;
+	auto cacheError = saved ? Geometry::loadHEMeshCache(cachePath, source, heMesh, Geometry::hardwareThreads(), nullptr, &cacheStats) : Geometry::HEMeshCacheError::OpenFailed;
+	auto t4 = std::chrono::high_resolution_clock::now();
+	spdlog::info("cache ({}): {:.1f} MB, save {:.1f} ms, load {:.1f} ms (map {:.2f} ms, checksum {:.1f} ms, topology {:.1f} ms, elements {:.1f} ms)",
+		Geometry::toString(cacheError), cacheStats.bytes / 1e6, std::chrono::duration<double, std::milli>(t3 - t2).count(),
+		std::chrono::duration<double, std::milli>(t4 - t3).count(), cacheStats.mapMs, cacheStats.checksumMs, cacheStats.topologyMs, cacheStats.elementsMs);
+	std::error_code ec;
+	std::filesystem::remove(cachePath, ec);
+
+	Geometry::Laplacian laplacian;
+	const auto& full = laplacian.Update(heMesh, Geometry::MassType::Voronoi, Geometry::hardwareThreads());
+	spdlog::info("Laplacian: {} nonzeros, structure {:.1f} ms, values {:.1f} ms", laplacian.Values().size(), full.structureMs, full.valuesMs);
+	for (int i = 0; i < 100; i++)
+		heMesh.positions[i * 4999 % positions.size()][2] += 1.f;
+	const auto& partial = laplacian.Update(heMesh, Geometry::MassType::Voronoi, Geometry::hardwareThreads());
+	spdlog::info("Laplacian after moving {} vertices: {} rows updated, {:.2f} ms", partial.changedVertices, partial.updatedRows, partial.valuesMs);
+}
+
 void DenoiseSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 	schedule.RegisterCommand([](Ubpa::UECS::World* w) {
 		auto data = w->entityMngr.GetSingleton<DenoiseData>();
@@ -18,6 +98,7 @@ void DenoiseSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 			if (ImGui::Button("Load mesh"))
 			{
 				data->heMesh->Init({ 0,1,3,2,3,1 }, 3);
+				noiseStream = 0;
 			}
 			if (ImGui::Button("Mesh to HEMesh")) {
 				data->heMesh->Clear();
@@ -34,18 +115,69 @@ void DenoiseSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 
 					data->copy = *data->mesh;
 
-					std::vector<size_t> indices(data->mesh->GetIndices().begin(), data->mesh->GetIndices().end());
-					data->heMesh->Init(indices, 3);
-					if (!data->heMesh->IsTriMesh())
-						spdlog::warn("HEMesh init fail");
-					
-					for (size_t i = 0; i < data->mesh->GetPositions().size(); i++)
-						data->heMesh->Vertices().at(i)->position = data->mesh->GetPositions().at(i);
+					Geometry::HEMeshBuildStats stats;
+					auto error = Geometry::buildHEMesh(data->mesh->GetIndices(), data->mesh->GetPositions(), *data->heMesh, Geometry::hardwareThreads(), &stats);
+					if (error != Geometry::TopologyError::None) {
+						spdlog::warn("HEMesh init fail: {}", Geometry::toString(error));
+						return;
+					}
 
+					spdlog::info("{} vertices, {} triangles, topology {:.2f} ms, elements {:.2f} ms", stats.vertices, stats.faces, stats.topologyMs, stats.elementsMs);
+					noiseStream = 0;
 					spdlog::info("Mesh to HEMesh success");
 				}();
 			}
 
+			if (ImGui::Button("Load OBJ to HEMesh"))
+				ImGui::OpenPopup("Load OBJ");
+			if (file_dialog.showFileDialog("Load OBJ", imgui_addons::ImGuiFileBrowser::DialogMode::OPEN, ImVec2(700, 310), ".obj,.*")) {
+				data->heMesh->Clear();
+				[&]() {
+					const int numThreads = Geometry::hardwareThreads();
+					const std::string cachePath = file_dialog.selected_path + ".hemesh";
+					uint64_t source = 0;
+					if (data->objTopologyCache && Geometry::checksumFile(file_dialog.selected_path, &source, numThreads)) {
+						Geometry::HEMeshCacheStats cacheStats;
+						auto cacheError = Geometry::loadHEMeshCache(cachePath, source, *data->heMesh, numThreads, nullptr, &cacheStats);
+						if (cacheError == Geometry::HEMeshCacheError::None) {
+							spdlog::info("{}: {} vertices, {} triangles, map {:.2f} ms, checksum {:.2f} ms, topology {:.2f} ms, elements {:.2f} ms",
+								cachePath, cacheStats.vertices, cacheStats.faces, cacheStats.mapMs, cacheStats.checksumMs, cacheStats.topologyMs, cacheStats.elementsMs);
+							noiseStream = 0;
+							spdlog::info("Load OBJ success (cached)");
+							return;
+						}
+						if (cacheError != Geometry::HEMeshCacheError::OpenFailed)
+							spdlog::warn("{}: {}, rebuilding", cachePath, Geometry::toString(cacheError));
+					}
+
+					std::vector<pointf3> positions;
+					std::vector<uint32_t> indices;
+					Geometry::ObjLoadStats objStats;
+					auto objError = Geometry::loadObj(file_dialog.selected_path, &positions, &indices, numThreads, &objStats);
+					if (objError != Geometry::ObjError::None) {
+						spdlog::warn("{}: {} at line {}", file_dialog.selected_path, Geometry::toString(objError), objStats.errorLine);
+						return;
+					}
+					spdlog::info("{}: {:.1f} MB, {} chunks, {} vertices, {} triangles ({} polygons split), map {:.2f} ms, count {:.2f} ms, parse {:.2f} ms",
+						file_dialog.selected_path, objStats.bytes / 1e6, objStats.chunks, objStats.vertices, objStats.faces, objStats.polygons,
+						objStats.mapMs, objStats.countMs, objStats.parseMs);
+
+					Geometry::HEMeshBuildStats stats;
+					Geometry::Topology topo;
+					auto error = Geometry::buildHEMesh(indices, positions, *data->heMesh, numThreads, &stats, &topo);
+					if (error != Geometry::TopologyError::None) {
+						spdlog::warn("HEMesh init fail: {}", Geometry::toString(error));
+						return;
+					}
+
+					spdlog::info("{} vertices, {} triangles, topology {:.2f} ms, elements {:.2f} ms", stats.vertices, stats.faces, stats.topologyMs, stats.elementsMs);
+					if (data->objTopologyCache && !Geometry::saveHEMeshCache(cachePath, topo, *data->heMesh, source, numThreads))
+						spdlog::warn("{}: write failed", cachePath);
+					noiseStream = 0;
+					spdlog::info("Load OBJ success");
+				}();
+			}
+
 			if (ImGui::Button("Add Noise")) {
 				[&]() {
 					if (!data->heMesh->IsTriMesh()) {
@@ -53,13 +185,133 @@ void DenoiseSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 						return;
 					}
 
-					for (auto* v : data->heMesh->Vertices()) {
-						v->position += data->randomScale * (
-							2.f * Ubpa::vecf3{ Ubpa::rand01<float>(),Ubpa::rand01<float>() ,Ubpa::rand01<float>() } - Ubpa::vecf3{ 1.f }
-						);
+					const auto type = static_cast<Geometry::NoiseType>(std::clamp(data->noiseType, 0, 2));
+					auto t0 = std::chrono::high_resolution_clock::now();
+					Geometry::addNoise(*data->heMesh, type, data->randomScale, static_cast<uint32_t>(data->noiseSeed), noiseStream, Geometry::hardwareThreads());
+					auto t1 = std::chrono::high_resolution_clock::now();
+
+					spdlog::info("Add noise success: seed {}, stream {}, {:.2f} ms", data->noiseSeed, noiseStream,
+						std::chrono::duration<double, std::milli>(t1 - t0).count());
+					++noiseStream;
+				}();
+			}
+
+			if (ImGui::Button("Denoise (bilateral)")) {
+				[&]() {
+					if (!data->heMesh->IsTriMesh()) {
+						spdlog::warn("HEMesh isn't triangle mesh");
+						return;
 					}
 
-					spdlog::info("Add noise success");
+					const int numThreads = Geometry::hardwareThreads();
+					bool cached = bilateralDenoise.TopologyVersion() == data->heMesh->TopologyVersion() && bilateralDenoise.IsVertexRing() == data->denoiseVertexRing
+						&& bilateralDenoise.Stats().faces == static_cast<int>(data->heMesh->Polygons().size());
+					if (!cached)
+						bilateralDenoise.Init(*data->heMesh, data->denoiseVertexRing, numThreads);
+					Geometry::BilateralDenoiseParams params;
+					params.normalIterations = data->denoiseNormalIterations;
+					params.vertexIterations = data->denoiseVertexIterations;
+					params.sigmaSpatial = data->denoiseSigmaSpatial;
+					params.sigmaNormal = data->denoiseSigmaNormal;
+					const auto& stats = bilateralDenoise.Run(*data->heMesh, params, numThreads);
+
+					spdlog::info("Bilateral denoise: {} faces, neighborhoods {:.2f} ms{}, face geometry {:.2f} ms, normal filtering {:.2f} ms, vertex update {:.2f} ms",
+						stats.faces, stats.setupMs, cached ? " (cached)" : "", stats.geometryMs, stats.normalMs, stats.vertexMs);
+				}();
+			}
+
+			if (ImGui::Button("Mean Curvature Flow")) {
+				[&]() {
+					if (!data->heMesh->IsTriMesh() || data->heMesh->IsEmpty()) {
+						spdlog::warn("HEMesh isn't triangle mesh or is empty");
+						return;
+					}
+
+					const int numThreads = Geometry::hardwareThreads();
+					int factorizations = 0, refinements = 0;
+					double laplacianMs = 0.0, assembleMs = 0.0, analyzeMs = 0.0, factorizeMs = 0.0, solveMs = 0.0;
+					for (int step = 0; step < data->mcfSteps; ++step) {
+						if (!meanCurvatureFlow.Step(*data->heMesh, data->mcfStepSize, data->mcfLagTolerance, numThreads)) {
+							meanCurvatureFlow.Clear();
+							spdlog::warn("Mean curvature flow failed at step {}", step);
+							return;
+						}
+						const auto& stats = meanCurvatureFlow.Stats();
+						factorizations += stats.factorized ? 1 : 0;
+						refinements += stats.refinements;
+						laplacianMs += stats.laplacianMs;
+						assembleMs += stats.assembleMs;
+						analyzeMs += stats.analyzeMs;
+						factorizeMs += stats.factorizeMs;
+						solveMs += stats.solveMs;
+					}
+
+					spdlog::info("Mean curvature flow: {} steps, {} interior vertices, {} factorizations, {} refinement sweeps, "
+						"laplacian {:.2f} ms, assemble {:.2f} ms, analyze {:.2f} ms, factorize {:.2f} ms, solve {:.2f} ms",
+						data->mcfSteps, meanCurvatureFlow.Stats().interior, factorizations, refinements,
+						laplacianMs, assembleMs, analyzeMs, factorizeMs, solveMs);
+				}();
+			}
+
+			if (ImGui::Button("Minimal Surface (local)")) {
+				[&]() {
+					if (!data->heMesh->IsTriMesh()) {
+						spdlog::warn("HEMesh isn't triangle mesh");
+						return;
+					}
+
+					Geometry::LocalMinSurf solver;
+					if (!solver.Init(*data->heMesh, data->cotangentWeights ? Geometry::Weighting::Cotangent : Geometry::Weighting::Uniform)) {
+						spdlog::warn("HEMesh has no boundary");
+						return;
+					}
+					const auto& stats = solver.Run(data->minSurfIterations, data->minSurfTolerance, Geometry::hardwareThreads(), data->minSurfRounds);
+					solver.Apply(*data->heMesh);
+
+					double total = 0.0, slowest = 0.0;
+					for (double ms : stats.iterationMs) {
+						total += ms;
+						slowest = std::max(slowest, ms);
+					}
+					spdlog::info("Minimal surface: {} iterations ({}), displacement {}, setup {:.2f} ms, iteration avg {:.3f} ms / max {:.3f} ms",
+						stats.iterations, stats.converged ? "converged" : "not converged", stats.displacement,
+						stats.setupMs, total / std::max(stats.iterations, 1), slowest);
+				}();
+			}
+
+			if (ImGui::Button("Minimal Surface (global)")) {
+				[&]() {
+					if (!data->heMesh->IsTriMesh()) {
+						spdlog::warn("HEMesh isn't triangle mesh");
+						return;
+					}
+
+					const int numThreads = Geometry::hardwareThreads();
+					const auto weighting = data->cotangentWeights ? Geometry::Weighting::Cotangent : Geometry::Weighting::Uniform;
+					const auto solver = data->minSurfCG ? Geometry::LinearSolver::CG : Geometry::LinearSolver::Auto;
+					bool cached = globalMinSurf.IsInitialized() && globalMinSurf.TopologyVersion() == data->heMesh->TopologyVersion()
+						&& globalMinSurf.GetWeighting() == weighting && globalMinSurf.GetLinearSolver() == solver;
+					if (!cached && !globalMinSurf.Init(*data->heMesh, weighting, solver, numThreads)) {
+						globalMinSurf.Clear();
+						spdlog::warn("HEMesh has no boundary or factorization failed");
+						return;
+					}
+					// cotangent weights follow the surface, each further round refactors numerically with the same pattern
+					bool success = globalMinSurf.Solve(*data->heMesh, numThreads);
+					for (int round = 1; success && weighting == Geometry::Weighting::Cotangent && round < data->minSurfRounds; ++round)
+						success = globalMinSurf.Refactor(numThreads) && globalMinSurf.Solve(*data->heMesh, numThreads);
+					if (!success) {
+						spdlog::warn("Minimal surface solve failed");
+						return;
+					}
+					globalMinSurf.Apply(*data->heMesh);
+
+					const auto& stats = globalMinSurf.Stats();
+					spdlog::info("Minimal surface (global, {}{}): {} interior vertices, setup {:.2f} ms, analyze {:.2f} ms, factorize {:.2f} ms, solve {:.2f} ms",
+						stats.useCG ? "CG" : "LDLT", cached ? ", cached factorization" : "", stats.interior,
+						stats.setupMs, stats.analyzeMs, stats.factorizeMs, stats.solveMs);
+					if (stats.useCG)
+						spdlog::info("CG: {} iterations, error {}", stats.cgIterations, stats.cgError);
 				}();
 			}
 
@@ -93,31 +345,18 @@ void DenoiseSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 						return;
 					}
 
-					data->mesh->SetToEditable();
-
-					const size_t N = data->heMesh->Vertices().size();
-					const size_t M = data->heMesh->Polygons().size();
-					std::vector<Ubpa::pointf3> positions(N);
-					std::vector<uint32_t> indices(M * 3);
-					for (size_t i = 0; i < N; i++)
-						positions[i] = data->heMesh->Vertices().at(i)->position;
-					for (size_t i = 0; i < M; i++) {
-						auto tri = data->heMesh->Indices(data->heMesh->Polygons().at(i));
-						indices[3 * i + 0] = static_cast<uint32_t>(tri[0]);
-						indices[3 * i + 1] = static_cast<uint32_t>(tri[1]);
-						indices[3 * i + 2] = static_cast<uint32_t>(tri[2]);
-					}
-					data->mesh->SetPositions(std::move(positions));
-					data->mesh->SetIndices(std::move(indices));
-					data->mesh->SetSubMeshCount(1);
-					data->mesh->SetSubMesh(0, { 0, M * 3 });
-					data->mesh->GenNormals();
+					const auto& stats = meshExporter.Export(*data->heMesh, *data->mesh, Geometry::hardwareThreads());
 					data->mesh->GenTangents();
 
+					spdlog::info("{} of {} vertices moved{}, {} normals updated, gather {:.2f} ms, normals {:.2f} ms, upload {:.2f} ms",
+						stats.changedVertices, data->heMesh->Vertices().size(), stats.topology ? " (indices rebuilt)" : "",
+						stats.updatedNormals, stats.gatherMs, stats.normalsMs, stats.uploadMs);
 					spdlog::info("HEMesh to Mesh success");
 				}();
 			}
 
+			if (ImGui::Button("Benchmark")) { benchmark(); }
+
 			if (ImGui::Button("Recover Mesh")) {
 				[&]() {
 					if (!data->mesh) {
@@ -130,6 +369,7 @@ void DenoiseSystem::OnUpdate(Ubpa::UECS::Schedule& schedule) {
 					}
 
 					*data->mesh = data->copy;
+					meshExporter.Invalidate();
 
 					spdlog::info("recover success");
 				}();